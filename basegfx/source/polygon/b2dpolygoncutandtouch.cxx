@@ -208,6 +208,55 @@ namespace basegfx
         void findTouches(const B2DPolygon& rEdgePolygon, const B2DPolygon& rPointPolygon, temporaryPointVector& rTempPoints);
         void findCuts(const B2DPolygon& rCandidateA, const B2DPolygon& rCandidateB, temporaryPointVector& rTempPointsA, temporaryPointVector& rTempPointsB);
 
+        // Straight edge of a polygon for the sweep over the x axis in findCuts. Only edges
+        // whose x ranges overlap can cut, so with edges sorted by their left x coordinate
+        // each edge needs to be compared only to the following ones starting left of its
+        // right end, and not to all other edges.
+        class sweepEdge
+        {
+            B2DPoint                            maStart;
+            B2DPoint                            maEnd;
+            B2DRange                            maRange;
+            sal_uInt32                          mnIndex;        // edge index in its polygon
+            bool                                mbSecond;       // edge of the second polygon
+
+        public:
+            sweepEdge(const B2DPoint& rStart, const B2DPoint& rEnd, sal_uInt32 nIndex, bool bSecond)
+            :   maStart(rStart),
+                maEnd(rEnd),
+                maRange(rStart, rEnd),
+                mnIndex(nIndex),
+                mbSecond(bSecond)
+            {
+            }
+
+            bool operator<(const sweepEdge& rComp) const
+            {
+                return (maRange.getMinX() < rComp.maRange.getMinX());
+            }
+
+            const B2DPoint& getStart() const { return maStart; }
+            const B2DPoint& getEnd() const { return maEnd; }
+            const B2DRange& getRange() const { return maRange; }
+            sal_uInt32 getIndex() const { return mnIndex; }
+            bool isSecond() const { return mbSecond; }
+        };
+
+        typedef ::std::vector< sweepEdge > sweepEdgeVector;
+
+        void appendSweepEdges(const B2DPolygon& rCandidate, sal_uInt32 nEdgeCount, bool bSecond, sweepEdgeVector& rEdges)
+        {
+            const sal_uInt32 nPointCount(rCandidate.count());
+            B2DPoint aCurr(rCandidate.getB2DPoint(0L));
+
+            for(sal_uInt32 a(0L); a < nEdgeCount; a++)
+            {
+                const B2DPoint aNext(rCandidate.getB2DPoint(a + 1L == nPointCount ? 0L : a + 1L));
+                rEdges.push_back(sweepEdge(aCurr, aNext, a, bSecond));
+                aCurr = aNext;
+            }
+        }
+
         void findEdgeCutsTwoEdges(
             const B2DPoint& rCurrA, const B2DPoint& rNextA,
             const B2DPoint& rCurrB, const B2DPoint& rNextB,
@@ -564,36 +613,33 @@ namespace basegfx
                     }
                     else
                     {
-                        B2DPoint aCurrA(rCandidate.getB2DPoint(0L));
+                        sweepEdgeVector aEdges;
+                        aEdges.reserve(nEdgeCount);
+                        appendSweepEdges(rCandidate, nEdgeCount, false, aEdges);
+                        ::std::sort(aEdges.begin(), aEdges.end());
 
-                        for(sal_uInt32 a(0L); a < nEdgeCount - 1L; a++)
+                        for(size_t i(0); i < aEdges.size(); i++)
                         {
-                            const B2DPoint aNextA(rCandidate.getB2DPoint(a + 1L == nPointCount ? 0L : a + 1L));
-                            const B2DRange aRangeA(aCurrA, aNextA);
-                            B2DPoint aCurrB(rCandidate.getB2DPoint(a + 1L));
-
-                            for(sal_uInt32 b(a + 1L); b < nEdgeCount; b++)
+                            for(size_t j(i + 1); j < aEdges.size() && aEdges[j].getRange().getMinX() <= aEdges[i].getRange().getMaxX(); j++)
                             {
-                                const B2DPoint aNextB(rCandidate.getB2DPoint(b + 1L == nPointCount ? 0L : b + 1L));
-                                const B2DRange aRangeB(aCurrB, aNextB);
+                                // keep the order of the edges in the polygon
+                                const bool bInOrder(aEdges[i].getIndex() < aEdges[j].getIndex());
+                                const sweepEdge& rEdgeA = bInOrder ? aEdges[i] : aEdges[j];
+                                const sweepEdge& rEdgeB = bInOrder ? aEdges[j] : aEdges[i];
+                                const sal_uInt32 a(rEdgeA.getIndex());
+                                const sal_uInt32 b(rEdgeB.getIndex());
 
                                 // consecutive segments touch of course
                                 bool bOverlap = false;
                                 if( b > a+1)
-                                    bOverlap = aRangeA.overlaps(aRangeB);
+                                    bOverlap = rEdgeA.getRange().overlaps(rEdgeB.getRange());
                                 else
-                                    bOverlap = aRangeA.overlapsMore(aRangeB);
+                                    bOverlap = rEdgeA.getRange().overlapsMore(rEdgeB.getRange());
                                 if( bOverlap)
                                 {
-                                    findEdgeCutsTwoEdges(aCurrA, aNextA, aCurrB, aNextB, a, b, rTempPoints, rTempPoints);
+                                    findEdgeCutsTwoEdges(rEdgeA.getStart(), rEdgeA.getEnd(), rEdgeB.getStart(), rEdgeB.getEnd(), a, b, rTempPoints, rTempPoints);
                                 }
-
-                                // prepare next step
-                                aCurrB = aNextB;
                             }
-
-                            // prepare next step
-                            aCurrA = aNextA;
                         }
                     }
                 }
@@ -800,37 +846,40 @@ namespace basegfx
                     }
                     else
                     {
-                        B2DPoint aCurrA(rCandidateA.getB2DPoint(0L));
+                        sweepEdgeVector aEdges;
+                        aEdges.reserve(nEdgeCountA + nEdgeCountB);
+                        appendSweepEdges(rCandidateA, nEdgeCountA, false, aEdges);
+                        appendSweepEdges(rCandidateB, nEdgeCountB, true, aEdges);
+                        ::std::sort(aEdges.begin(), aEdges.end());
 
-                        for(sal_uInt32 a(0L); a < nEdgeCountA; a++)
+                        for(size_t i(0); i < aEdges.size(); i++)
                         {
-                            const B2DPoint aNextA(rCandidateA.getB2DPoint(a + 1L == nPointCountA ? 0L : a + 1L));
-                            const B2DRange aRangeA(aCurrA, aNextA);
-                            B2DPoint aCurrB(rCandidateB.getB2DPoint(0L));
-
-                            for(sal_uInt32 b(0L); b < nEdgeCountB; b++)
+                            for(size_t j(i + 1); j < aEdges.size() && aEdges[j].getRange().getMinX() <= aEdges[i].getRange().getMaxX(); j++)
                             {
-                                const B2DPoint aNextB(rCandidateB.getB2DPoint(b + 1L == nPointCountB ? 0L : b + 1L));
-                                const B2DRange aRangeB(aCurrB, aNextB);
+                                if(aEdges[i].isSecond() == aEdges[j].isSecond())
+                                {
+                                    // edges of the same polygon
+                                    continue;
+                                }
+
+                                const bool bFirstIsA(!aEdges[i].isSecond());
+                                const sweepEdge& rEdgeA = bFirstIsA ? aEdges[i] : aEdges[j];
+                                const sweepEdge& rEdgeB = bFirstIsA ? aEdges[j] : aEdges[i];
+                                const sal_uInt32 a(rEdgeA.getIndex());
+                                const sal_uInt32 b(rEdgeB.getIndex());
 
                                 // consecutive segments touch of course
                                 bool bOverlap = false;
                                 if( b > a+1)
-                                    bOverlap = aRangeA.overlaps(aRangeB);
+                                    bOverlap = rEdgeA.getRange().overlaps(rEdgeB.getRange());
                                 else
-                                    bOverlap = aRangeA.overlapsMore(aRangeB);
+                                    bOverlap = rEdgeA.getRange().overlapsMore(rEdgeB.getRange());
                                 if( bOverlap)
                                 {
                                     // test for simple edge-edge cuts
-                                    findEdgeCutsTwoEdges(aCurrA, aNextA, aCurrB, aNextB, a, b, rTempPointsA, rTempPointsB);
+                                    findEdgeCutsTwoEdges(rEdgeA.getStart(), rEdgeA.getEnd(), rEdgeB.getStart(), rEdgeB.getEnd(), a, b, rTempPointsA, rTempPointsB);
                                 }
-
-                                // prepare next step
-                                aCurrB = aNextB;
                             }
-
-                            // prepare next step
-                            aCurrA = aNextA;
                         }
                     }
                 }
@@ -30,6 +30,7 @@
 #include <basegfx/curve/b2dbeziertools.hxx>
 #include <basegfx/polygon/b2dpolypolygontools.hxx>
 #include <basegfx/polygon/b2dpolygonclipper.hxx>
+#include <basegfx/polygon/b2dpolygoncutandtouch.hxx>
 #include <basegfx/polygon/b2dpolypolygon.hxx>
 #include <basegfx/polygon/b2dtrapezoid.hxx>
 #include <basegfx/range/b2irange.hxx>
@@ -845,12 +846,39 @@ public:
                                !tools::isRectangle( aNonRect5 ));
     }
 
+    void testAddPointsAtCuts()
+    {
+        // pentagram, five self intersections each adding a point to two edges
+        B2DPolygon aStar;
+        for( sal_uInt32 i=0; i<5; ++i )
+        {
+            const double fAngle( F_PI2 + ( i * 4 * F_PI ) / 5 );
+            aStar.append( B2DPoint( cos( fAngle ), sin( fAngle ) ) );
+        }
+        aStar.setClosed(true);
+
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("checking self cuts of pentagram",
+                                     sal_uInt32(15), tools::addPointsAtCutsAndTouches( aStar ).count());
+
+        // two overlapping squares, cutting each other twice
+        B2DPolyPolygon aSquares;
+        aSquares.append( tools::createPolygonFromRect( B2DRange(0,0,2,2) ) );
+        aSquares.append( tools::createPolygonFromRect( B2DRange(1,1,3,3) ) );
+
+        const B2DPolyPolygon aCut( tools::addPointsAtCutsAndTouches( aSquares, false ) );
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("checking cuts of first square",
+                                     sal_uInt32(6), aCut.getB2DPolygon(0).count());
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("checking cuts of second square",
+                                     sal_uInt32(6), aCut.getB2DPolygon(1).count());
+    }
+
     // Change the following lines only, if you add, remove or rename
     // member functions of the current class,
     // because these macros are need by auto register mechanism.
 
     CPPUNIT_TEST_SUITE(b2dpolygontools);
     CPPUNIT_TEST(testIsRectangle);
+    CPPUNIT_TEST(testAddPointsAtCuts);
     CPPUNIT_TEST_SUITE_END();
 }; // class b2dpolygontools
 
@@ -20,6 +20,7 @@
 #include <tools/stream.hxx>
 #include <tools/tenccvt.hxx>
 #include <osl/thread.h>
+#include <rtl/math.hxx>
 #include <basic/sbx.hxx>
 #include "sb.hxx"
 #include <string.h>
@@ -61,6 +62,8 @@ void SbiImage::Clear()
     pStringOff = nullptr;
     pStrings   = nullptr;
     pCode      = nullptr;
+    aNumbers.clear();
+    aNumbersSet.clear();
     nFlags     = SbiImageFlags::NONE;
     nStrings   = 0;
     nStringSize= 0;
@@ -565,6 +568,8 @@ void SbiImage::MakeStrings( short nSize )
     nStrings = nSize;
     memset( pStringOff, 0, nSize * sizeof( sal_uInt32 ) );
     memset( pStrings, 0, nStringSize * sizeof( sal_Unicode ) );
+    aNumbers.clear();
+    aNumbersSet.clear();
 }
 
 // Add a string to StringPool. The String buffer is dynamically
@@ -672,6 +677,33 @@ OUString SbiImage::GetString( short nId ) const
     return OUString();
 }
 
+// Numeric constants are stored as strings in the pool; loops would
+// otherwise parse the same literal again on every pass.
+double SbiImage::GetNumber( short nId ) const
+{
+    if( nId <= 0 || nId > nStrings )
+        return 0.0;
+    if( aNumbersSet.size() != static_cast<size_t>( nStrings ) )
+    {
+        aNumbers.assign( nStrings, 0.0 );
+        aNumbersSet.assign( nStrings, false );
+    }
+    if( !aNumbersSet[ nId - 1 ] )
+    {
+        // #57844 use localized function
+        OUString aStr = GetString( nId );
+        // also allow , !!!
+        sal_Int32 iComma = aStr.indexOf((sal_Unicode)',');
+        if( iComma >= 0 )
+        {
+            aStr = aStr.replaceAt(iComma, 1, ".");
+        }
+        aNumbers[ nId - 1 ] = ::rtl::math::stringToDouble( aStr, '.', ',' );
+        aNumbersSet[ nId - 1 ] = true;
+    }
+    return aNumbers[ nId - 1 ];
+}
+
 const SbxObject* SbiImage::FindType (const OUString& aTypeName) const
 {
     return rTypes.Is() ? static_cast<SbxObject*>(rTypes->Find(aTypeName,SbxCLASS_OBJECT)) : nullptr;
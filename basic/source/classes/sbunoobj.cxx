@@ -2226,17 +2226,15 @@ void SbUnoObject::Notify( SfxBroadcaster& rBC, const SfxHint& rHint )
 
                     if( nAllocParamCount > 0 )
                     {
+                        const std::vector<Type>& rParamTypes = pMeth->getParamTypes();
                         args.realloc( nAllocParamCount );
                         Any* pAnyArgs = args.getArray();
                         for( i = 0 ; i < nParamCount ; i++ )
                         {
                             const ParamInfo& rInfo = pParamInfos[i];
-                            const Reference< XIdlClass >& rxClass = rInfo.aType;
-
-                            css::uno::Type aType( rxClass->getTypeClass(), rxClass->getName() );
 
                             // ATTENTION: Don't forget for Sbx-Parameter the offset!
-                            pAnyArgs[i] = sbxToUnoValue( pParams->Get( (sal_uInt16)(i+1) ), aType );
+                            pAnyArgs[i] = sbxToUnoValue( pParams->Get( (sal_uInt16)(i+1) ), rParamTypes[i] );
 
                             // If it is not certain check whether the out-parameter are available.
                             if( !bOutParams )
@@ -2581,6 +2579,24 @@ const Sequence<ParamInfo>& SbUnoMethod::getParamInfos()
     return *pParamInfoSeq;
 }
 
+// Resolving the type of a parameter means a type description lookup by
+// name, so do it once per method instead of once per call
+const std::vector<Type>& SbUnoMethod::getParamTypes()
+{
+    const Sequence<ParamInfo>& rInfoSeq = getParamInfos();
+    if( maParamTypes.size() != static_cast<size_t>( rInfoSeq.getLength() ) )
+    {
+        maParamTypes.clear();
+        maParamTypes.reserve( rInfoSeq.getLength() );
+        for( const ParamInfo& rInfo : rInfoSeq )
+        {
+            const Reference< XIdlClass >& rxClass = rInfo.aType;
+            maParamTypes.push_back( Type( rxClass->getTypeClass(), rxClass->getName() ) );
+        }
+    }
+    return maParamTypes;
+}
+
 SbUnoProperty::SbUnoProperty
 (
     const OUString& aName_,
@@ -24,6 +24,7 @@
 #include <rtl/ustring.hxx>
 #include <filefmt.hxx>
 #include <o3tl/typed_flags_set.hxx>
+#include <vector>
 
 // This class reads in the image that's been produced by the compiler
 // and manages the access to the single elements.
@@ -61,6 +62,8 @@ class SbiImage {
                                     // temporary management-variable:
     short          nStringIdx;
     sal_uInt32     nStringOff;      // current Pos in the stringbuffer
+    mutable std::vector<double> aNumbers;    // parsed numeric constants
+    mutable std::vector<bool>   aNumbersSet; // ... and which are parsed yet
                                     // routines for the compiler:
     void MakeStrings( short );      // establish StringPool
     void AddString( const OUString& );
@@ -88,6 +91,7 @@ public:
     sal_uInt32  GetCodeSize() const { return nCodeSize; }
     sal_uInt16  GetBase() const     { return nDimBase;  }
     OUString    GetString( short nId ) const;
+    double      GetNumber( short nId ) const;  // numeric constant, parsed once
     const SbxObject* FindType (const OUString& aTypeName) const;
 
     SbxArrayRef GetEnums()          { return rEnums; }
@@ -155,6 +155,7 @@ class SbUnoMethod : public SbxMethod
 
     css::uno::Reference< css::reflection::XIdlMethod > m_xUnoMethod;
     css::uno::Sequence< css::reflection::ParamInfo >* pParamInfoSeq;
+    std::vector< css::uno::Type > maParamTypes; // resolved from pParamInfoSeq
 
     // #67781 reference to the previous and the next method in the method list
     SbUnoMethod* pPrev;
@@ -170,6 +171,7 @@ public:
     virtual SbxInfo* GetInfo() override;
 
     const css::uno::Sequence< css::reflection::ParamInfo >& getParamInfos();
+    const std::vector< css::uno::Type >& getParamTypes();
 
     bool isInvocationBased()
         { return mbInvocation; }
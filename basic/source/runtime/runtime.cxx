@@ -2807,18 +2807,7 @@ void SbiRuntime::StepERROR()
 void SbiRuntime::StepLOADNC( sal_uInt32 nOp1 )
 {
     SbxVariable* p = new SbxVariable( SbxDOUBLE );
-
-    // #57844 use localized function
-    OUString aStr = pImg->GetString( static_cast<short>( nOp1 ) );
-    // also allow , !!!
-    sal_Int32 iComma = aStr.indexOf((sal_Unicode)',');
-    if( iComma >= 0 )
-    {
-        aStr = aStr.replaceAt(iComma, 1, ".");
-    }
-    double n = ::rtl::math::stringToDouble( aStr, '.', ',' );
-
-    p->PutDouble( n );
+    p->PutDouble( pImg->GetNumber( static_cast<short>( nOp1 ) ) );
     PushVar( p );
 }
 
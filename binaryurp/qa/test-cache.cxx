@@ -23,6 +23,8 @@
 #include <cppunit/extensions/HelperMacros.h>
 #include <cppunit/plugin/TestPlugIn.h>
 
+#include <memory>
+
 #include "../source/cache.hxx"
 
 namespace {
@@ -31,11 +33,33 @@ class Test: public CppUnit::TestFixture {
 private:
     CPPUNIT_TEST_SUITE(Test);
     CPPUNIT_TEST(testNothingLostFromLruList);
+    CPPUNIT_TEST(testHitsAndEvictions);
+    CPPUNIT_TEST(testSpareNodeReused);
+    CPPUNIT_TEST(testSpareNodeReleased);
     CPPUNIT_TEST_SUITE_END();
 
     void testNothingLostFromLruList();
+    void testHitsAndEvictions();
+    void testSpareNodeReused();
+    void testSpareNodeReleased();
 };
 
+// counts how often an entry is copy-constructed, i.e. put into a new list node
+struct Counted {
+    static int copies;
+
+    int value;
+
+    Counted(): value(0) {}
+    explicit Counted(int n): value(n) {}
+    Counted(Counted const & other): value(other.value) { ++copies; }
+    Counted & operator =(Counted const &) = default;
+
+    bool operator <(Counted const & other) const { return value < other.value; }
+};
+
+int Counted::copies = 0;
+
 // cf. jurt/test/com/sun/star/lib/uno/protocols/urp/Cache_Test.java:
 void Test::testNothingLostFromLruList() {
     int a[8];
@@ -68,6 +92,80 @@ void Test::testNothingLostFromLruList() {
     }
 }
 
+void Test::testHitsAndEvictions() {
+    binaryurp::Cache< int > c(2);
+    bool f;
+    CPPUNIT_ASSERT_EQUAL(0, int(c.add(10, &f)));
+    CPPUNIT_ASSERT(!f);
+    CPPUNIT_ASSERT_EQUAL(1, int(c.add(20, &f)));
+    CPPUNIT_ASSERT(!f);
+    // hits keep their index and make the entry the most recently used one
+    CPPUNIT_ASSERT_EQUAL(0, int(c.add(10, &f)));
+    CPPUNIT_ASSERT(f);
+    // the least recently used entry 20 is evicted and its index reused
+    CPPUNIT_ASSERT_EQUAL(1, int(c.add(30, &f)));
+    CPPUNIT_ASSERT(!f);
+    CPPUNIT_ASSERT_EQUAL(0, int(c.add(10, &f)));
+    CPPUNIT_ASSERT(f);
+    CPPUNIT_ASSERT_EQUAL(1, int(c.add(20, &f)));
+    CPPUNIT_ASSERT(!f);
+    CPPUNIT_ASSERT_EQUAL(1, int(c.add(20, &f)));
+    CPPUNIT_ASSERT(f);
+    CPPUNIT_ASSERT_EQUAL(0, int(c.add(10, &f)));
+    CPPUNIT_ASSERT(f);
+
+    binaryurp::Cache< int > off(0);
+    CPPUNIT_ASSERT_EQUAL(int(binaryurp::cache::ignore), int(off.add(10, &f)));
+    CPPUNIT_ASSERT(!f);
+}
+
+void Test::testSpareNodeReused() {
+    binaryurp::Cache< Counted > c(2);
+    bool f;
+    Counted::copies = 0;
+    c.add(Counted(1), &f);
+    CPPUNIT_ASSERT_EQUAL(1, Counted::copies);
+    // the first hit needs a new node, which is kept as spare afterwards
+    c.add(Counted(1), &f);
+    CPPUNIT_ASSERT(f);
+    CPPUNIT_ASSERT_EQUAL(2, Counted::copies);
+    // further hits and new entries use the spare node
+    c.add(Counted(1), &f);
+    CPPUNIT_ASSERT(f);
+    c.add(Counted(2), &f);
+    CPPUNIT_ASSERT(!f);
+    CPPUNIT_ASSERT_EQUAL(2, Counted::copies);
+    // the node of an evicted entry becomes the spare one
+    c.add(Counted(3), &f);
+    CPPUNIT_ASSERT(!f);
+    CPPUNIT_ASSERT_EQUAL(3, Counted::copies);
+    c.add(Counted(4), &f);
+    CPPUNIT_ASSERT(!f);
+    c.add(Counted(4), &f);
+    CPPUNIT_ASSERT(f);
+    CPPUNIT_ASSERT_EQUAL(3, Counted::copies);
+}
+
+void Test::testSpareNodeReleased() {
+    std::shared_ptr< int > p1(std::make_shared< int >(1));
+    std::shared_ptr< int > p2(std::make_shared< int >(2));
+    std::shared_ptr< int > p3(std::make_shared< int >(3));
+    binaryurp::Cache< std::shared_ptr< int > > c(2);
+    bool f;
+    c.add(p1, &f);
+    c.add(p2, &f);
+    CPPUNIT_ASSERT_EQUAL(2L, long(p1.use_count()));
+    // the looked up content does not stay in the spare node
+    c.add(p1, &f);
+    CPPUNIT_ASSERT(f);
+    CPPUNIT_ASSERT_EQUAL(2L, long(p1.use_count()));
+    // neither does an evicted one
+    c.add(p3, &f);
+    CPPUNIT_ASSERT(!f);
+    CPPUNIT_ASSERT_EQUAL(1L, long(p2.use_count()));
+    CPPUNIT_ASSERT_EQUAL(2L, long(p3.use_count()));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(Test);
 
 }
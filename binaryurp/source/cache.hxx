@@ -54,14 +54,21 @@ public:
             return cache::ignore;
         }
         // try to insert into the map
-        list_.push_front( rContent); // create a temp entry
+        // create a temp entry, reusing a spare list node if there is one
+        if( spare_.empty())
+            list_.push_front( rContent);
+        else {
+            spare_.front() = rContent;
+            list_.splice( list_.begin(), spare_, spare_.begin());
+        }
         typedef std::pair<typename LruList::iterator, IdxType> MappedType;
         typedef std::pair<typename LruItMap::iterator,bool> MapPair;
         MapPair aMP = map_.insert( MappedType( list_.begin(), 0));
         *pbFound = !aMP.second;
 
         if( !aMP.second) { // insertion not needed => found the entry
-            list_.pop_front(); // remove the temp entry
+            spare_.splice( spare_.begin(), list_, list_.begin()); // keep the temp entry's node for the next lookup
+            spare_.front() = T(); // but do not keep its content alive
             list_.splice( list_.begin(), list_, aMP.first->first); // the found entry is moved to front
             return aMP.first->second;
         }
@@ -73,7 +80,8 @@ public:
             typename LruItMap::iterator it = map_.find( --list_.end());
             n = it->second;
             map_.erase( it); // remove it from the map
-            list_.pop_back(); // remove from the list
+            spare_.splice( spare_.begin(), list_, --list_.end()); // remove from the list
+            spare_.front() = T(); // release the evicted content
         }
         aMP.first->second = n;
         return n;
@@ -91,6 +99,7 @@ private:
     std::size_t size_;
     LruItMap map_;
     LruList list_;
+    LruList spare_; // at most one unused node, to avoid an allocation per add
 };
 
 }
@@ -38,6 +38,21 @@
 
 namespace binaryurp {
 
+namespace {
+
+// Once this many bytes of queued messages are marshaled, send them off
+// before marshaling further queued ones:
+std::vector< unsigned char >::size_type const MAX_BLOCK_SIZE = 64 * 1024;
+
+void writeHeader32(sal_Int8 * buffer, sal_uInt32 value) {
+    buffer[0] = static_cast< sal_Int8 >(value >> 24);
+    buffer[1] = static_cast< sal_Int8 >((value >> 16) & 0xFF);
+    buffer[2] = static_cast< sal_Int8 >((value >> 8) & 0xFF);
+    buffer[3] = static_cast< sal_Int8 >(value & 0xFF);
+}
+
+}
+
 Writer::Item::Item()
     : request(false)
     , setter(false)
@@ -69,7 +84,7 @@ Writer::Item::Item(
 
 Writer::Writer(rtl::Reference< Bridge > const  & bridge):
     Thread("binaryurpWriter"), bridge_(bridge), marshal_(bridge, state_),
-    stop_(false)
+    bufferedMessages_(0), stop_(false)
 {
     OSL_ASSERT(bridge.is());
 }
@@ -84,6 +99,7 @@ void Writer::sendDirectRequest(
     sendRequest(
         tid, oid, type, member, inArguments, false,
         css::uno::UnoInterfaceReference());
+    flush();
 }
 
 void Writer::sendDirectReply(
@@ -93,6 +109,8 @@ void Writer::sendDirectReply(
 {
     OSL_ASSERT(!unblocked_.check());
     sendReply(tid, member, false, exception, returnValue,outArguments);
+    flush();
+    bridge_->decrementCalls();
 }
 
 void Writer::queueRequest(
@@ -144,36 +162,51 @@ void Writer::execute() {
         unblocked_.wait();
         for (;;) {
             items_.wait();
-            Item item;
+            std::deque< Item > items;
             {
                 osl::MutexGuard g(mutex_);
                 if (stop_) {
                     return;
                 }
                 OSL_ASSERT(!queue_.empty());
-                item = queue_.front();
-                queue_.pop_front();
-                if (queue_.empty()) {
-                    items_.reset();
-                }
+                items.swap(queue_);
+                items_.reset();
             }
-            if (item.request) {
-                sendRequest(
-                    item.tid, item.oid, item.type, item.member, item.arguments,
-                    (item.oid != "UrpProtocolProperties" &&
-                     !item.member.equals(
-                         css::uno::TypeDescription(
-                             "com.sun.star.uno.XInterface::release")) &&
-                     bridge_->isCurrentContextMode()),
-                    item.currentContext);
-            } else {
-                sendReply(
-                    item.tid, item.member, item.setter, item.exception,
-                    item.returnValue, item.arguments);
-                if (item.setCurrentContextMode) {
-                    bridge_->setCurrentContextMode();
+            // Everything queued meanwhile goes out in as few blocks as
+            // possible, instead of one connection write per message:
+            sal_uInt32 replies = 0;
+            for (std::deque< Item >::const_iterator i(items.begin());
+                 i != items.end(); ++i)
+            {
+                if (i->request) {
+                    sendRequest(
+                        i->tid, i->oid, i->type, i->member, i->arguments,
+                        (i->oid != "UrpProtocolProperties" &&
+                         !i->member.equals(
+                             css::uno::TypeDescription(
+                                 "com.sun.star.uno.XInterface::release")) &&
+                         bridge_->isCurrentContextMode()),
+                        i->currentContext);
+                } else {
+                    sendReply(
+                        i->tid, i->member, i->setter, i->exception,
+                        i->returnValue, i->arguments);
+                    ++replies;
+                    if (i->setCurrentContextMode) {
+                        bridge_->setCurrentContextMode();
+                    }
+                }
+                if (buffer_.size() >= MAX_BLOCK_SIZE) {
+                    flush();
+                    for (; replies != 0; --replies) {
+                        bridge_->decrementCalls();
+                    }
                 }
             }
+            flush();
+            for (; replies != 0; --replies) {
+                bridge_->decrementCalls();
+            }
         }
     } catch (const css::uno::Exception & e) {
         OSL_TRACE(
@@ -240,7 +273,7 @@ void Writer::sendRequest(
     if (functionId > SAL_MAX_UINT16) {
         throw css::uno::RuntimeException("function ID too large for URP");
     }
-    std::vector< unsigned char > buf;
+    std::vector< unsigned char > & buf = buffer_;
     bool newType = !(lastType_.is() && t.equals(lastType_));
     bool newOid = oid != lastOid_;
     bool newTid = tid != lastTid_;
@@ -329,7 +362,7 @@ void Writer::sendRequest(
         OSL_ASSERT(false); // this cannot happen
         break;
     }
-    sendMessage(buf);
+    ++bufferedMessages_;
     lastType_ = t;
     lastOid_ = oid;
     lastTid_ = tid;
@@ -342,7 +375,7 @@ void Writer::sendReply(
     std::vector< BinaryAny > const & outArguments)
 {
     OSL_ASSERT(tid.getLength() != 0 && member.is() && member.get()->bComplete);
-    std::vector< unsigned char > buf;
+    std::vector< unsigned char > & buf = buffer_;
     bool newTid = tid != lastTid_;
     Marshal::write8(&buf, 0x80 | (exception ? 0x20 : 0) | (newTid ? 0x08 : 0));
         // bit 7: LONGHEADER; bit 6: !REQUEST; bit 5: EXCEPTION; bit 3: NEWTID
@@ -395,32 +428,30 @@ void Writer::sendReply(
             break;
         }
     }
-    sendMessage(buf);
+    ++bufferedMessages_;
     lastTid_ = tid;
-    bridge_->decrementCalls();
 }
 
-void Writer::sendMessage(std::vector< unsigned char > const & buffer) {
-    std::vector< unsigned char > header;
-    if (buffer.size() > SAL_MAX_UINT32) {
+void Writer::flush() {
+    if (bufferedMessages_ == 0) {
+        return;
+    }
+    if (buffer_.size() > SAL_MAX_UINT32) {
         throw css::uno::RuntimeException(
             "message too large for URP");
     }
-    Marshal::write32(&header, static_cast< sal_uInt32 >(buffer.size()));
-    Marshal::write32(&header, 1);
-    OSL_ASSERT(!buffer.empty());
-    unsigned char const * p = &buffer[0];
-    std::vector< unsigned char >::size_type n = buffer.size();
-    OSL_ASSERT(header.size() <= SAL_MAX_INT32 && SAL_MAX_INT32 <= SAL_MAX_SIZE);
-    sal_Size k = SAL_MAX_INT32 - header.size();
+    OSL_ASSERT(!buffer_.empty());
+    unsigned char const * p = &buffer_[0];
+    std::vector< unsigned char >::size_type n = buffer_.size();
+    sal_Size const headerSize = 8;
+    sal_Size k = SAL_MAX_INT32 - headerSize;
     if (n < k) {
         k = static_cast< sal_Size >(n);
     }
     css::uno::Sequence< sal_Int8 > s(
-        static_cast< sal_Int32 >(header.size() + k));
-    OSL_ASSERT(!header.empty());
-    memcpy(
-        s.getArray(), &header[0], static_cast< sal_Size >(header.size()));
+        static_cast< sal_Int32 >(headerSize + k));
+    writeHeader32(s.getArray(), static_cast< sal_uInt32 >(n));
+    writeHeader32(s.getArray() + 4, bufferedMessages_);
     for (;;) {
         memcpy(s.getArray() + s.getLength() - k, p, k);
         try {
@@ -442,6 +473,12 @@ void Writer::sendMessage(std::vector< unsigned char > const & buffer) {
         }
         s.realloc(k);
     }
+    if (buffer_.capacity() > 16 * MAX_BLOCK_SIZE) {
+        std::vector< unsigned char >().swap(buffer_); // do not keep huge ones
+    } else {
+        buffer_.clear();
+    }
+    bufferedMessages_ = 0;
 }
 
 }
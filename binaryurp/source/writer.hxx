@@ -85,6 +85,8 @@ private:
 
     virtual void execute() override;
 
+    // sendRequest and sendReply only append a message to buffer_; flush sends
+    // all messages appended since the last flush as a single block:
     void sendRequest(
         rtl::ByteSequence const & tid, OUString const & oid,
         com::sun::star::uno::TypeDescription const & type,
@@ -98,7 +100,7 @@ private:
         bool exception, BinaryAny const & returnValue,
         std::vector< BinaryAny > const & outArguments);
 
-    void sendMessage(std::vector< unsigned char > const & buffer);
+    void flush();
 
     struct Item {
         Item();
@@ -150,6 +152,8 @@ private:
     com::sun::star::uno::TypeDescription lastType_;
     OUString lastOid_;
     rtl::ByteSequence lastTid_;
+    std::vector< unsigned char > buffer_; // reused across blocks
+    sal_uInt32 bufferedMessages_;
     osl::Condition unblocked_;
     osl::Condition items_;
 
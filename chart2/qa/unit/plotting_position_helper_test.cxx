@@ -0,0 +1,132 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/plugin/TestPlugIn.h>
+
+#include <com/sun/star/drawing/PolyPolygonShape3D.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "PlottingPositionHelper.hxx"
+
+
+class PlottingPositionHelperTest : public CppUnit::TestFixture
+{
+public:
+     CPPUNIT_TEST_SUITE(PlottingPositionHelperTest);
+     CPPUNIT_TEST(testDecimatePolygon);
+     CPPUNIT_TEST_SUITE_END();
+
+     void testDecimatePolygon();
+
+private:
+};
+
+void PlottingPositionHelperTest::testDecimatePolygon()
+{
+    const sal_Int32 nXResolution = 10;
+    const double fMaxX = 1000.0;
+
+    std::vector<chart::ExplicitScaleData> aScales(3);
+    aScales[0].Maximum = fMaxX;
+    aScales[1].Maximum = 100.0;
+    aScales[2].Maximum = 1.0;
+
+    chart::PlottingPositionHelper aHelper;
+    aHelper.setScales(aScales, false);
+    css::uno::Sequence<sal_Int32> aResolution(3);
+    aResolution[0] = nXResolution;
+    aResolution[1] = 1000;
+    aResolution[2] = 1000;
+    aHelper.setCoordinateSystemResolution(aResolution);
+
+    // a jagged line with a thousand points per x resolution cell
+    const sal_Int32 nPointCount = 10000;
+    css::drawing::PolyPolygonShape3D aSource;
+    aSource.SequenceX.realloc(1);
+    aSource.SequenceY.realloc(1);
+    aSource.SequenceZ.realloc(1);
+    aSource.SequenceX[0].realloc(nPointCount);
+    aSource.SequenceY[0].realloc(nPointCount);
+    aSource.SequenceZ[0].realloc(nPointCount);
+    for (sal_Int32 i = 0; i < nPointCount; ++i)
+    {
+        aSource.SequenceX[0][i] = i * fMaxX / nPointCount;
+        aSource.SequenceY[0][i] = std::fmod(i * 37.0, 101.0) - (i % 7) * 0.5;
+        aSource.SequenceZ[0][i] = 0.0;
+    }
+
+    css::drawing::PolyPolygonShape3D aTarget;
+    CPPUNIT_ASSERT(aHelper.decimatePolygon(aSource, aTarget));
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), aTarget.SequenceX.getLength());
+    const sal_Int32 nTargetCount = aTarget.SequenceX[0].getLength();
+    CPPUNIT_ASSERT(nTargetCount <= 4 * nXResolution);
+
+    // the cell of a point as PlottingPositionHelper::isSameForGivenResolution sees it
+    auto getCell = [&](double fX) { return static_cast<sal_Int32>(nXResolution * fX / fMaxX); };
+
+    for (sal_Int32 nCell = 0; nCell < nXResolution; ++nCell)
+    {
+        sal_Int32 nFirst = -1, nLast = -1;
+        double fMin = 0.0, fMax = 0.0;
+        for (sal_Int32 i = 0; i < nPointCount; ++i)
+        {
+            if (getCell(aSource.SequenceX[0][i]) != nCell)
+                continue;
+            const double fY = aSource.SequenceY[0][i];
+            if (nFirst == -1)
+            {
+                nFirst = i;
+                fMin = fMax = fY;
+            }
+            nLast = i;
+            fMin = std::min(fMin, fY);
+            fMax = std::max(fMax, fY);
+        }
+        CPPUNIT_ASSERT(nFirst != -1);
+
+        std::vector<sal_Int32> aKept;
+        for (sal_Int32 i = 0; i < nTargetCount; ++i)
+            if (getCell(aTarget.SequenceX[0][i]) == nCell)
+                aKept.push_back(i);
+        CPPUNIT_ASSERT(!aKept.empty());
+        CPPUNIT_ASSERT(aKept.size() <= 4);
+
+        // first and last point of the cell are kept, and so are its extremes
+        CPPUNIT_ASSERT_EQUAL(aSource.SequenceX[0][nFirst], aTarget.SequenceX[0][aKept.front()]);
+        CPPUNIT_ASSERT_EQUAL(aSource.SequenceY[0][nFirst], aTarget.SequenceY[0][aKept.front()]);
+        CPPUNIT_ASSERT_EQUAL(aSource.SequenceX[0][nLast], aTarget.SequenceX[0][aKept.back()]);
+        CPPUNIT_ASSERT_EQUAL(aSource.SequenceY[0][nLast], aTarget.SequenceY[0][aKept.back()]);
+
+        double fKeptMin = aTarget.SequenceY[0][aKept.front()];
+        double fKeptMax = fKeptMin;
+        for (sal_Int32 i : aKept)
+        {
+            fKeptMin = std::min(fKeptMin, aTarget.SequenceY[0][i]);
+            fKeptMax = std::max(fKeptMax, aTarget.SequenceY[0][i]);
+        }
+        CPPUNIT_ASSERT_EQUAL(fMin, fKeptMin);
+        CPPUNIT_ASSERT_EQUAL(fMax, fKeptMax);
+    }
+
+    // the points keep their order
+    for (sal_Int32 i = 1; i < nTargetCount; ++i)
+        CPPUNIT_ASSERT(aTarget.SequenceX[0][i - 1] <= aTarget.SequenceX[0][i]);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(PlottingPositionHelperTest);
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -411,7 +411,12 @@ bool AreaChart::impl_createLine( VDataSeries* pSeries
     else
     { // default to creating a straight line
         SAL_WARN_IF(CurveStyle_LINES != m_eCurveStyle, "chart2.areachart", "Unknown curve style");
-        Clipping::clipPolygonAtRectangle( *pSeriesPoly, pPosHelper->getScaledLogicClipDoubleRect(), aPoly );
+        drawing::PolyPolygonShape3D aDecimatedPoly;
+        pPosHelper->setCoordinateSystemResolution( m_aCoordinateSystemResolution );
+        if( m_nDimension!=3 && pPosHelper->decimatePolygon( *pSeriesPoly, aDecimatedPoly ) )
+            Clipping::clipPolygonAtRectangle( aDecimatedPoly, pPosHelper->getScaledLogicClipDoubleRect(), aPoly );
+        else
+            Clipping::clipPolygonAtRectangle( *pSeriesPoly, pPosHelper->getScaledLogicClipDoubleRect(), aPoly );
     }
 
     if(!AbstractShapeFactory::hasPolygonAnyLines(aPoly))
@@ -56,6 +56,16 @@ public:
     inline void   setCoordinateSystemResolution( const ::com::sun::star::uno::Sequence< sal_Int32 >& rCoordinateSystemResolution );
     inline bool   isSameForGivenResolution( double fX, double fY, double fZ
                                 , double fX2, double fY2, double fZ2 );
+    /** Reduce a line with many more points than the x resolution
+
+        All consecutive points falling into the same x resolution cell are replaced by
+        the first, the lowest, the highest and the last of them. This keeps the rendered
+        envelope of the line intact while a line over several hundred thousand data rows
+        only keeps a few points per device pixel column. Returns false if nothing needed
+        to be reduced, rTarget is untouched then. The points are expected to be scaled.
+    */
+    bool    decimatePolygon( const ::com::sun::star::drawing::PolyPolygonShape3D& rSource
+                           , ::com::sun::star::drawing::PolyPolygonShape3D& rTarget );
 
     inline bool   isStrongLowerRequested( sal_Int32 nDimensionIndex ) const;
     inline bool   isLogicVisible( double fX, double fY, double fZ ) const;
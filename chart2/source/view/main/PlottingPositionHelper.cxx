@@ -34,6 +34,8 @@
 
 #include <rtl/math.hxx>
 
+#include <algorithm>
+
 namespace chart
 {
 using namespace ::com::sun::star;
@@ -241,6 +243,76 @@ void PlottingPositionHelper::transformScaledLogicToScene( drawing::PolyPolygonSh
     }
 }
 
+bool PlottingPositionHelper::decimatePolygon( const drawing::PolyPolygonShape3D& rSource
+                                             , drawing::PolyPolygonShape3D& rTarget )
+{
+    sal_Int32 nPolyCount = rSource.SequenceX.getLength();
+    sal_Int32 nTotalPointCount = 0;
+    for( sal_Int32 nPolygonIndex = 0; nPolygonIndex<nPolyCount; nPolygonIndex++ )
+        nTotalPointCount += rSource.SequenceX[nPolygonIndex].getLength();
+    if( m_nXResolution<=0 || nTotalPointCount <= 4*m_nXResolution )
+        return false;
+
+    rTarget.SequenceX.realloc(nPolyCount);
+    rTarget.SequenceY.realloc(nPolyCount);
+    rTarget.SequenceZ.realloc(nPolyCount);
+
+    for( sal_Int32 nPolygonIndex = 0; nPolygonIndex<nPolyCount; nPolygonIndex++ )
+    {
+        const double* pSourceX = rSource.SequenceX[nPolygonIndex].getConstArray();
+        const double* pSourceY = rSource.SequenceY[nPolygonIndex].getConstArray();
+        const double* pSourceZ = rSource.SequenceZ[nPolygonIndex].getConstArray();
+        sal_Int32 nPointCount = rSource.SequenceX[nPolygonIndex].getLength();
+
+        drawing::DoubleSequence& rTargetX = rTarget.SequenceX.getArray()[nPolygonIndex];
+        drawing::DoubleSequence& rTargetY = rTarget.SequenceY.getArray()[nPolygonIndex];
+        drawing::DoubleSequence& rTargetZ = rTarget.SequenceZ.getArray()[nPolygonIndex];
+        rTargetX.realloc(nPointCount);
+        rTargetY.realloc(nPointCount);
+        rTargetZ.realloc(nPointCount);
+        double* pTargetX = rTargetX.getArray();
+        double* pTargetY = rTargetY.getArray();
+        double* pTargetZ = rTargetZ.getArray();
+        sal_Int32 nTargetPointCount = 0;
+
+        sal_Int32 nStart = 0;
+        while( nStart<nPointCount )
+        {
+            //find the run of points within the x resolution cell of the first one
+            sal_Int32 nEnd = nStart+1;
+            sal_Int32 nMin = nStart;
+            sal_Int32 nMax = nStart;
+            while( nEnd<nPointCount
+                && isSameForGivenResolution( pSourceX[nStart], 0.0, 0.0, pSourceX[nEnd], 0.0, 0.0 ) )
+            {
+                if( pSourceY[nEnd]<pSourceY[nMin] )
+                    nMin = nEnd;
+                if( pSourceY[nEnd]>pSourceY[nMax] )
+                    nMax = nEnd;
+                nEnd++;
+            }
+
+            //keep the selected points in their original order
+            sal_Int32 aKeep[4] = { nStart, std::min( nMin, nMax ), std::max( nMin, nMax ), nEnd-1 };
+            for( sal_Int32 nKeep = 0; nKeep<4; nKeep++ )
+            {
+                if( nKeep && aKeep[nKeep]==aKeep[nKeep-1] )
+                    continue;
+                pTargetX[nTargetPointCount] = pSourceX[aKeep[nKeep]];
+                pTargetY[nTargetPointCount] = pSourceY[aKeep[nKeep]];
+                pTargetZ[nTargetPointCount] = pSourceZ[aKeep[nKeep]];
+                nTargetPointCount++;
+            }
+            nStart = nEnd;
+        }
+
+        rTargetX.realloc(nTargetPointCount);
+        rTargetY.realloc(nTargetPointCount);
+        rTargetZ.realloc(nTargetPointCount);
+    }
+    return true;
+}
+
 void PlottingPositionHelper::clipScaledLogicValues( double* pX, double* pY, double* pZ ) const
 {
     //get logic clip values:
@@ -94,10 +94,16 @@ OKeyValue* OResultSet::GetOrderbyKeyValue(OValueRefRow& _rRow)
     OKeyValue* pKeyValue = OKeyValue::createKeyValue((sal_uInt32)nBookmarkValue);
 
     ::std::vector<sal_Int32>::iterator aIter = m_aOrderbyColumnNumber.begin();
-    for (;aIter != m_aOrderbyColumnNumber.end(); ++aIter)
+    for (::std::vector<sal_Int32>::size_type i=0;aIter != m_aOrderbyColumnNumber.end(); ++aIter,++i)
     {
         OSL_ENSURE(*aIter < static_cast<sal_Int32>(_rRow->get().size()),"Invalid index for orderkey values!");
-        pKeyValue->pushKey(new ORowSetValueDecorator((_rRow->get())[*aIter]->getValue()));
+        const ORowSetValue& rValue = (_rRow->get())[*aIter]->getValue();
+        // numeric, date and time keys are compared as double; convert them once here
+        // instead of in every comparison while sorting
+        if (m_pSortIndex && m_pSortIndex->getKeyType()[i] == SQL_ORDERBYKEY_DOUBLE && !rValue.isNull())
+            pKeyValue->pushKey(new ORowSetValueDecorator(ORowSetValue(rValue.getDouble())));
+        else
+            pKeyValue->pushKey(new ORowSetValueDecorator(rValue));
     }
 
     return pKeyValue;
@@ -68,6 +68,7 @@ void OFlatTable::fillColumns(const ::com::sun::star::lang::Locale& _aLocale)
     m_bNeedToReadLine = true; // we overwrite m_aCurrentLine, seek the stream, ...
     m_pFileStream->Seek(0);
     m_aCurrentLine = QuotedTokenizedString();
+    m_nCurrentLinePos = -1;
     bool bRead = true;
 
     const OFlatConnection* const pConnection = getFlatConnection();
@@ -400,6 +401,7 @@ OFlatTable::OFlatTable(sdbcx::OCollection* _pTables,OFlatConnection* _pConnectio
                                   _Description,
                                   _SchemaName,
                                   _CatalogName)
+    ,m_nCurrentLinePos(-1)
     ,m_nRowPos(0)
     ,m_nMaxRowCount(0)
     ,m_cStringDelimiter(_pConnection->getStringDelimiter())
@@ -585,6 +587,12 @@ bool OFlatTable::fetchRow(OValueRefRow& _rRow, const OSQLColumns & _rCols, bool
         return true;
 
     bool result = false;
+    if ( m_bNeedToReadLine && m_nFilePos == m_nCurrentLinePos )
+    {
+        // e.g. sorting and evaluating a row fetch the same row twice in a row,
+        // the line is still there, no need to read it from the file again
+        m_bNeedToReadLine = false;
+    }
     if ( m_bNeedToReadLine )
     {
         m_pFileStream->Seek(m_nFilePos);
@@ -800,9 +808,7 @@ bool OFlatTable::seekRow(IResultSetHelper::Movement eCursorPosition, sal_Int32 n
             break;
         case IResultSetHelper::LAST:
             if (m_nMaxRowCount == 0)
-            {
-                while(seekRow(IResultSetHelper::NEXT, 1, nCurPos)) ; // run through after last row
-            }
+                readRowPositions(SAL_MAX_INT32); // run through after last row
             // m_nMaxRowCount can still be zero, but now it means there a genuinely zero rows in the table
             return seekRow(IResultSetHelper::ABSOLUTE1, m_nMaxRowCount, nCurPos);
             break;
@@ -843,23 +849,23 @@ bool OFlatTable::seekRow(IResultSetHelper::Movement eCursorPosition, sal_Int32 n
                 assert(m_nRowPos >=0);
                 assert(m_aRowPosToFilePos.size() > static_cast< vector< TRowPositionInFile >::size_type >(m_nRowPos));
                 assert(nOffset >= 0);
-                if(m_aRowPosToFilePos.size() > static_cast< vector< TRowPositionInFile >::size_type >(nOffset))
-                {
-                    m_nFilePos  = m_aRowPosToFilePos[nOffset].first;
-                    nCurPos     = m_aRowPosToFilePos[nOffset].second;
-                    m_nRowPos   = nOffset;
-                    m_bNeedToReadLine = true;
-                }
-                else
+                if(m_aRowPosToFilePos.size() <= static_cast< vector< TRowPositionInFile >::size_type >(nOffset))
                 {
-                    assert(m_nRowPos < nOffset);
-                    while(m_nRowPos < nOffset)
+                    readRowPositions(nOffset);
+                    if(m_aRowPosToFilePos.size() <= static_cast< vector< TRowPositionInFile >::size_type >(nOffset))
                     {
-                        if(!seekRow(IResultSetHelper::NEXT, 1, nCurPos))
-                            return false;
+                        // behind the last row
+                        m_nRowPos = m_nMaxRowCount + 1;
+                        const TRowPositionInFile &lastRowPos(m_aRowPosToFilePos.back());
+                        m_nFilePos = lastRowPos.second;
+                        nCurPos = lastRowPos.second;
+                        return false;
                     }
-                    assert(m_nRowPos == nOffset);
                 }
+                m_nFilePos  = m_aRowPosToFilePos[nOffset].first;
+                nCurPos     = m_aRowPosToFilePos[nOffset].second;
+                m_nRowPos   = nOffset;
+                m_bNeedToReadLine = true;
             }
 
             break;
@@ -886,14 +892,39 @@ bool OFlatTable::seekRow(IResultSetHelper::Movement eCursorPosition, sal_Int32 n
 }
 
 
+void OFlatTable::readRowPositions(const sal_Int32 nUpToRow)
+{
+    // Jumping to a row or to the end used to step through all unknown rows one at a
+    // time via seekRow; read the remaining lines sequentially instead, only recording
+    // where each row starts and ends. The positions then give direct access to every
+    // row in both directions.
+    assert(!m_aRowPosToFilePos.empty());
+    m_pFileStream->Seek(m_aRowPosToFilePos.back().second);
+    m_bNeedToReadLine = true;
+
+    while(m_aRowPosToFilePos.size() <= static_cast< vector< TRowPositionInFile >::size_type >(nUpToRow))
+    {
+        TRowPositionInFile aRowPos;
+        if(!readLine(&aRowPos.second, &aRowPos.first))
+        {
+            m_nMaxRowCount = m_aRowPosToFilePos.size() - 1;
+            break;
+        }
+        m_aRowPosToFilePos.push_back(aRowPos);
+    }
+}
+
 bool OFlatTable::readLine(sal_Int32 * const pEndPos, sal_Int32 * const pStartPos, const bool nonEmpty)
 {
     const rtl_TextEncoding nEncoding = m_pConnection->getTextEncoding();
     m_aCurrentLine = QuotedTokenizedString();
+    m_nCurrentLinePos = -1;
+    sal_Int32 nLineStartPos = 0;
     do
     {
+        nLineStartPos = (sal_Int32)m_pFileStream->Tell();
         if (pStartPos)
-            *pStartPos = (sal_Int32)m_pFileStream->Tell();
+            *pStartPos = nLineStartPos;
         m_pFileStream->ReadByteStringLine(m_aCurrentLine, nEncoding);
         if (m_pFileStream->IsEof())
             return false;
@@ -914,6 +945,7 @@ bool OFlatTable::readLine(sal_Int32 * const pEndPos, sal_Int32 * const pStartPos
     }
     while(nonEmpty && m_aCurrentLine.Len() == 0);
 
+    m_nCurrentLinePos = nLineStartPos;
     if(pEndPos)
         *pEndPos = (sal_Int32)m_pFileStream->Tell();
     return true;
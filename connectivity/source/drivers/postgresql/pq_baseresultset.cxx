@@ -37,6 +37,7 @@
 #include <osl/thread.h>
 
 #include <rtl/ustrbuf.hxx>
+#include <rtl/math.hxx>
 
 #include <cppuhelper/typeprovider.hxx>
 #include <cppuhelper/queryinterface.hxx>
@@ -367,6 +368,42 @@ sal_Bool BaseResultSet::wasNull(  ) throw (SQLException, RuntimeException, std::
     return m_wasNull;
 }
 
+// Values arrive from the server as text, and converting every single one
+// through the UNO type converter is comparatively expensive. Handle the
+// plain decimal forms PostgreSQL sends for numbers here; everything else
+// (NULL, hex, NaN, out of range, ...) still goes through convertTo.
+static bool getPlainInteger( const Any & val, sal_Int64 & rnVal )
+{
+    OUString str;
+    if( ! (val >>= str) )
+        return false;
+    const sal_Int32 nLen = str.getLength();
+    sal_Int32 nPos = ( nLen && str[0] == '-' ) ? 1 : 0;
+    // up to 15 digits are exact when the converter goes via double
+    if( nPos == nLen || nLen - nPos > 15 )
+        return false;
+    for( ; nPos < nLen ; nPos ++ )
+    {
+        if( str[nPos] < '0' || str[nPos] > '9' )
+            return false;
+    }
+    rnVal = str.toInt64();
+    return true;
+}
+
+static bool getPlainDouble( const Any & val, double & rfVal )
+{
+    OUString str;
+    if( ! (val >>= str) )
+        return false;
+    const double f = str.toDouble();
+    // 0.0 may also mean the string was not a number at all
+    if( f == 0.0 || ! rtl::math::isFinite( f ) )
+        return false;
+    rfVal = f;
+    return true;
+}
+
 Any BaseResultSet::convertTo( const Any & val , const Type & type )
 {
     Any aRet;
@@ -449,8 +486,12 @@ sal_Int32 BaseResultSet::getInt( sal_Int32 columnIndex )
     checkClosed();
     checkColumnIndex( columnIndex );
     checkRowIndex( true /* must be on row */ );
+    const Any val( getValue( columnIndex ) );
+    sal_Int64 n = 0;
+    if( getPlainInteger( val, n ) && n >= SAL_MIN_INT32 && n <= SAL_MAX_INT32 )
+        return static_cast< sal_Int32 >( n );
     sal_Int32 i = 0;
-    convertTo( getValue( columnIndex ), cppu::UnoType<decltype(i)>::get()) >>= i;
+    convertTo( val, cppu::UnoType<decltype(i)>::get()) >>= i;
     return i;
 }
 
@@ -461,8 +502,11 @@ sal_Int64 BaseResultSet::getLong( sal_Int32 columnIndex )
     checkClosed();
     checkColumnIndex( columnIndex );
     checkRowIndex( true /* must be on row */ );
+    const Any val( getValue( columnIndex ) );
     sal_Int64 i = 0;
-    convertTo( getValue( columnIndex ), cppu::UnoType<decltype(i)>::get()) >>= i;
+    if( getPlainInteger( val, i ) )
+        return i;
+    convertTo( val, cppu::UnoType<decltype(i)>::get()) >>= i;
     return i;
 }
 
@@ -484,8 +528,11 @@ double BaseResultSet::getDouble( sal_Int32 columnIndex )
     MutexGuard guard( m_refMutex->mutex );
     checkClosed();
     checkColumnIndex( columnIndex );
+    const Any val( getValue( columnIndex ) );
     double d = 0.;
-    convertTo( getValue( columnIndex ), cppu::UnoType<decltype(d)>::get()) >>= d;
+    if( getPlainDouble( val, d ) )
+        return d;
+    convertTo( val, cppu::UnoType<decltype(d)>::get()) >>= d;
     return d;
 }
 
@@ -48,6 +48,7 @@ namespace connectivity
             ::std::vector<sal_Int32>        m_aPrecisions;  // same as aboth
             ::std::vector<sal_Int32>        m_aScales;
             QuotedTokenizedString           m_aCurrentLine;
+            sal_Int32                       m_nCurrentLinePos;      // file position m_aCurrentLine was read from, -1 if none
             ::com::sun::star::uno::Reference< ::com::sun::star::util::XNumberFormatter > m_xNumberFormatter;
             ::com::sun::star::util::Date    m_aNullDate;
             sal_Int32                       m_nRowPos;
@@ -58,6 +59,7 @@ namespace connectivity
         private:
             void fillColumns(const ::com::sun::star::lang::Locale& _aLocale);
             bool readLine(sal_Int32 *pEndPos = nullptr, sal_Int32 *pStartPos = nullptr, bool nonEmpty = false);
+            void readRowPositions(sal_Int32 nUpToRow);
             void setRowPos(::std::vector<TRowPositionInFile>::size_type rowNum, const TRowPositionInFile &rowPos);
             void impl_fillColumnInfo_nothrow(QuotedTokenizedString& aFirstLine, sal_Int32& nStartPosFirstLine, sal_Int32& nStartPosFirstLine2,
                                              sal_Int32& io_nType, sal_Int32& io_nPrecisions, sal_Int32& io_nScales, OUString& o_sTypeName,
@@ -111,6 +111,7 @@
 #include <svtools/accessibilityoptions.hxx>
 #include <svtools/apearcfg.hxx>
 #include <vcl/graphicfilter.hxx>
+#include <tools/time.hxx>
 
 #include "langselect.hxx"
 
@@ -1606,8 +1607,11 @@ int Desktop::Main()
 
         SetSplashScreenProgress(80);
 
+        // headless instances never show a systray icon, so don't activate
+        // the quickstart service for them (--headless does not imply
+        // --invisible)
         if ( !bTerminateRequested && !rCmdLineArgs.IsInvisible() &&
-             !rCmdLineArgs.IsNoQuickstart() )
+             !rCmdLineArgs.IsHeadless() && !rCmdLineArgs.IsNoQuickstart() )
             InitializeQuickstartMode( xContext );
 
         try
@@ -2748,6 +2752,15 @@ void Desktop::OpenSplashScreen()
 
 void Desktop::SetSplashScreenProgress(sal_Int32 iProgress)
 {
+    // The progress steps double as a startup timeline; trace them even when
+    // no splash screen is shown (headless, invisible, conversion) so slow
+    // phases of those startups can be spotted with SAL_LOG=+INFO.desktop.app
+    static sal_uInt64 const nStartTicks = tools::Time::GetSystemTicks();
+    SAL_INFO(
+        "desktop.app",
+        "startup progress " << iProgress << "% after "
+            << (tools::Time::GetSystemTicks() - nStartTicks) << " ms");
+
     if(m_rSplashScreen.is())
     {
         m_rSplashScreen->setValue(iProgress);
@@ -54,6 +54,8 @@
 #include <tools/urlobj.hxx>
 #include <unotools/mediadescriptor.hxx>
 
+#include <map>
+#include <utility>
 #include <vector>
 #include <osl/thread.hxx>
 #include <osl/file.hxx>
@@ -158,13 +160,32 @@ catch ( const Exception& )
 }
 }
 
-OUString impl_GuessFilter( const OUString& rUrlOut, const OUString& rDocService )
+// guessed export filters, keyed on target extension and document service
+typedef std::map< std::pair< OUString, OUString >, OUString > GuessedFilterMap;
+
+OUString impl_GuessFilter( const OUString& rUrlOut, const OUString& rDocService,
+                           GuessedFilterMap& rGuessedFilters )
 {
+    // A batch conversion guesses the filter for the same target extension
+    // and document type over and over; the guess only depends on those, so
+    // do the type detection and filter enumeration once per combination
+    // and remember the result in the caller's map for the rest of the batch.
+    const std::pair< OUString, OUString > aKey(
+        INetURLObject( rUrlOut ).getExtension(), rDocService );
+    if ( !aKey.first.isEmpty() )
+    {
+        auto pGuessed = rGuessedFilters.find( aKey );
+        if ( pGuessed != rGuessedFilters.end() )
+            return pGuessed->second;
+    }
+
     OUString aOutFilter;
     const SfxFilter* pOutFilter = impl_getExportFilterFromUrl( rUrlOut, rDocService );
     if (pOutFilter)
         aOutFilter = pOutFilter->GetFilterName();
 
+    if ( !aKey.first.isEmpty() && !aOutFilter.isEmpty() )
+        rGuessedFilters[ aKey ] = aOutFilter;
     return aOutFilter;
 }
 
@@ -224,6 +245,7 @@ bool DispatchWatcher::executeDispatchRequests( const DispatchList& aDispatchRequ
     OUString                 aAsTemplateArg( "AsTemplate" );
     bool                     bSetInputFilter = false;
     OUString                 aForcedInputFilter;
+    GuessedFilterMap         aGuessedFilters;
 
     for ( p = aDispatchRequestsList.begin(); p != aDispatchRequestsList.end(); ++p )
     {
@@ -534,7 +556,7 @@ bool DispatchWatcher::executeDispatchRequests( const DispatchList& aDispatchRequ
                                     utl::MediaDescriptor aMediaDesc( xModel->getArgs() );
                                     aDocService = aMediaDesc.getUnpackedValueOrDefault(utl::MediaDescriptor::PROP_DOCUMENTSERVICE(), OUString() );
                                 }
-                                aFilter = impl_GuessFilter( aOutFile, aDocService );
+                                aFilter = impl_GuessFilter( aOutFile, aDocService, aGuessedFilters );
                             }
 
                             if (aFilter.isEmpty())
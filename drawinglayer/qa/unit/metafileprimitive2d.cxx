@@ -0,0 +1,80 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <sal/config.h>
+
+#include <test/bootstrapfixture.hxx>
+
+#include <basegfx/matrix/b2dhommatrixtools.hxx>
+#include <drawinglayer/geometry/viewinformation2d.hxx>
+#include <drawinglayer/primitive2d/metafileprimitive2d.hxx>
+#include <drawinglayer/primitive2d/transformprimitive2d.hxx>
+#include <rtl/ref.hxx>
+#include <vcl/gdimtf.hxx>
+#include <vcl/metaact.hxx>
+
+namespace
+{
+
+using namespace drawinglayer::primitive2d;
+
+class Test : public test::BootstrapFixture
+{
+    void testDecompositionShared();
+
+public:
+    CPPUNIT_TEST_SUITE(Test);
+    CPPUNIT_TEST(testDecompositionShared);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+/// returns the interpreted metafile content below the embedding transformation
+Primitive2DContainer getInterpretedContent(const MetafilePrimitive2D& rPrimitive)
+{
+    const drawinglayer::geometry::ViewInformation2D aViewInformation;
+    const Primitive2DContainer aDecomposition(rPrimitive.get2DDecomposition(aViewInformation));
+    CPPUNIT_ASSERT_EQUAL(size_t(1), aDecomposition.size());
+    const TransformPrimitive2D* pTransform = dynamic_cast<const TransformPrimitive2D*>(aDecomposition[0].get());
+    CPPUNIT_ASSERT(pTransform);
+    return pTransform->getChildren();
+}
+
+void Test::testDecompositionShared()
+{
+    GDIMetaFile aMtf;
+    aMtf.AddAction(new MetaLineColorAction(Color(COL_BLACK), true));
+    aMtf.AddAction(new MetaFillColorAction(Color(COL_LIGHTRED), true));
+    aMtf.AddAction(new MetaRectAction(Rectangle(Point(10, 10), Size(80, 80))));
+    aMtf.SetPrefSize(Size(100, 100));
+    aMtf.SetPrefMapMode(MapMode(MAP_100TH_MM));
+
+    // the same graphic shown at two places, e.g. on two pages
+    const rtl::Reference<MetafilePrimitive2D> xFirst(new MetafilePrimitive2D(
+        basegfx::tools::createScaleTranslateB2DHomMatrix(1000.0, 1000.0, 0.0, 0.0), aMtf));
+    const rtl::Reference<MetafilePrimitive2D> xSecond(new MetafilePrimitive2D(
+        basegfx::tools::createScaleTranslateB2DHomMatrix(500.0, 500.0, 2000.0, 3000.0), aMtf));
+
+    const Primitive2DContainer aFirst(getInterpretedContent(*xFirst));
+    const Primitive2DContainer aSecond(getInterpretedContent(*xSecond));
+
+    // the second decomposition is served from the cache: it shares the very
+    // same primitives instead of interpreting the metafile again
+    CPPUNIT_ASSERT(!aFirst.empty());
+    CPPUNIT_ASSERT_EQUAL(aFirst.size(), aSecond.size());
+    for (size_t i = 0; i < aFirst.size(); ++i)
+        CPPUNIT_ASSERT_EQUAL(aFirst[i].get(), aSecond[i].get());
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(Test);
+
+}
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
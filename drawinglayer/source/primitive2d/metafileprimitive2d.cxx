@@ -53,6 +53,11 @@
 #include <drawinglayer/primitive2d/textstrikeoutprimitive2d.hxx>
 #include <drawinglayer/primitive2d/epsprimitive2d.hxx>
 #include <tools/fract.hxx>
+#include <comphelper/processfactory.hxx>
+#include <comphelper/unique_disposing_ptr.hxx>
+#include <rtl/instance.hxx>
+#include <vcl/timer.hxx>
+#include <list>
 #include <numeric>
 
 
@@ -3163,35 +3168,198 @@ namespace
 } // end of anonymous namespace
 
 
+// cache of interpreted metafiles
+
+namespace
+{
+    class ImpMetafileDecompositionCache;
+
+    //the scoped_MetafileDecompositionCache owns the ImpMetafileDecompositionCache
+    //and releases it on dtor or disposing of the default XComponentContext, so
+    //that no primitives survive the VCL they were created with
+    class scoped_MetafileDecompositionCache : public comphelper::unique_disposing_ptr<ImpMetafileDecompositionCache>
+    {
+    public:
+        scoped_MetafileDecompositionCache() : comphelper::unique_disposing_ptr<ImpMetafileDecompositionCache>((css::uno::Reference<css::lang::XComponent>(::comphelper::getProcessComponentContext(), css::uno::UNO_QUERY_THROW)))
+        {
+        }
+    };
+
+    class the_scoped_MetafileDecompositionCache : public rtl::Static<scoped_MetafileDecompositionCache, the_scoped_MetafileDecompositionCache> {};
+
+    /** Interpreting a metafile only depends on its actions and its MapUnit,
+        not on the transformation it is shown with. The interpreted and
+        immutable primitives are thus shared by all MetafilePrimitive2D
+        showing the same graphic (e.g. the same clip-art on several pages),
+        keyed by the metafile checksum. The least recently used entries are
+        dropped when the estimated size of all entries (embedded bitmaps
+        included) exceeds a budget, and the whole cache is released when it
+        was not used for a while.
+    */
+    class ImpMetafileDecompositionCache : public Timer
+    {
+    public:
+        typedef std::pair< BitmapChecksum, MapUnit > Key;
+
+    private:
+        struct Entry
+        {
+            Key                                             maKey;
+            drawinglayer::primitive2d::Primitive2DContainer maContent;
+            sal_uLong                                       mnSizeBytes;
+        };
+        typedef std::list< Entry > Entries;
+
+        scoped_MetafileDecompositionCache&  mrOwnerOfMe;
+        Entries                             maEntries;
+        sal_uLong                           mnSizeBytes;
+
+    public:
+        explicit ImpMetafileDecompositionCache(scoped_MetafileDecompositionCache& rOwnerOfMe);
+        virtual ~ImpMetafileDecompositionCache();
+        virtual void Invoke() override;
+
+        bool get(const Key& rKey, drawinglayer::primitive2d::Primitive2DContainer& rContent);
+        void put(const Key& rKey, const drawinglayer::primitive2d::Primitive2DContainer& rContent, sal_uLong nSizeBytes);
+    };
+
+    ImpMetafileDecompositionCache::ImpMetafileDecompositionCache(scoped_MetafileDecompositionCache& rOwnerOfMe)
+    :   Timer( "Timer to release the drawinglayer metafile decomposition cache" ),
+        mrOwnerOfMe(rOwnerOfMe),
+        maEntries(),
+        mnSizeBytes(0)
+    {
+        SetTimeout(3L * 60L * 1000L); // three minutes
+        Start();
+    }
+
+    ImpMetafileDecompositionCache::~ImpMetafileDecompositionCache()
+    {
+        // the primitives may hold VCL resources
+        const SolarMutexGuard aGuard;
+        maEntries.clear();
+    }
+
+    void ImpMetafileDecompositionCache::Invoke()
+    {
+        // for obvious reasons, do not call anything after this
+        mrOwnerOfMe.reset();
+    }
+
+    bool ImpMetafileDecompositionCache::get(const Key& rKey, drawinglayer::primitive2d::Primitive2DContainer& rContent)
+    {
+        for(Entries::iterator aIter(maEntries.begin()); aIter != maEntries.end(); ++aIter)
+        {
+            if(aIter->maKey == rKey)
+            {
+                // move to front, it is the most recently used one now
+                maEntries.splice(maEntries.begin(), maEntries, aIter);
+                rContent = maEntries.front().maContent;
+                Start();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void ImpMetafileDecompositionCache::put(const Key& rKey, const drawinglayer::primitive2d::Primitive2DContainer& rContent, sal_uLong nSizeBytes)
+    {
+        // budget for all entries; the count limit only keeps the lookup cheap
+        static const sal_uLong nMaxSizeBytes(16UL * 1024UL * 1024UL);
+        static const size_t nMaxEntries(64);
+
+        // a single huge graphic would just push out everything else
+        if(nSizeBytes > nMaxSizeBytes / 4)
+        {
+            return;
+        }
+
+        // another thread may have interpreted the same graphic meanwhile
+        for(Entries::const_iterator aIter(maEntries.begin()); aIter != maEntries.end(); ++aIter)
+        {
+            if(aIter->maKey == rKey)
+            {
+                return;
+            }
+        }
+
+        const Entry aEntry = { rKey, rContent, nSizeBytes };
+        maEntries.push_front(aEntry);
+        mnSizeBytes += nSizeBytes;
+
+        while(mnSizeBytes > nMaxSizeBytes || maEntries.size() > nMaxEntries)
+        {
+            mnSizeBytes -= maEntries.back().mnSizeBytes;
+            maEntries.pop_back();
+        }
+
+        Start();
+    }
+
+    ImpMetafileDecompositionCache& getMetafileDecompositionCache()
+    {
+        scoped_MetafileDecompositionCache& rCache = the_scoped_MetafileDecompositionCache::get();
+
+        if(!rCache)
+        {
+            rCache.reset(new ImpMetafileDecompositionCache(rCache));
+        }
+
+        return *rCache;
+    }
+} // end of anonymous namespace
+
+
 namespace drawinglayer
 {
     namespace primitive2d
     {
         Primitive2DContainer MetafilePrimitive2D::create2DDecomposition(const geometry::ViewInformation2D& rViewInformation) const
         {
-            // prepare target and porperties; each will have one default entry
-            TargetHolders aTargetHolders;
-            PropertyHolders aPropertyHolders;
+            // the interpreted content may already be known from another
+            // MetafilePrimitive2D showing the same graphic; the cache and its
+            // Timer are guarded by the SolarMutex, interpreting is not
+            const ImpMetafileDecompositionCache::Key aKey(
+                getMetaFile().GetChecksum(),
+                getMetaFile().GetPrefMapMode().GetMapUnit());
+            Primitive2DContainer xRetval;
+            bool bCached(false);
+
+            {
+                const SolarMutexGuard aSolarGuard;
+                bCached = getMetafileDecompositionCache().get(aKey, xRetval);
+            }
 
-            // set target MapUnit at Properties
-            aPropertyHolders.Current().setMapUnit(getMetaFile().GetPrefMapMode().GetMapUnit());
+            if(!bCached)
+            {
+                // prepare target and porperties; each will have one default entry
+                TargetHolders aTargetHolders;
+                PropertyHolders aPropertyHolders;
 
-            // interpret the Metafile
-            interpretMetafile(getMetaFile(), aTargetHolders, aPropertyHolders, rViewInformation);
+                // set target MapUnit at Properties
+                aPropertyHolders.Current().setMapUnit(getMetaFile().GetPrefMapMode().GetMapUnit());
 
-            // get the content. There should be only one target, as in the start condition,
-            // but iterating will be the right thing to do when some push/pop is not closed
-            Primitive2DContainer xRetval;
+                // interpret the Metafile
+                interpretMetafile(getMetaFile(), aTargetHolders, aPropertyHolders, rViewInformation);
+
+                // get the content. There should be only one target, as in the start condition,
+                // but iterating will be the right thing to do when some push/pop is not closed
+                while(aTargetHolders.size() > 1)
+                {
+                    xRetval.append(
+                        aTargetHolders.Current().getPrimitive2DSequence(aPropertyHolders.Current()));
+                    aTargetHolders.Pop();
+                }
 
-            while(aTargetHolders.size() > 1)
-            {
                 xRetval.append(
                     aTargetHolders.Current().getPrimitive2DSequence(aPropertyHolders.Current()));
-                aTargetHolders.Pop();
-            }
 
-            xRetval.append(
-                aTargetHolders.Current().getPrimitive2DSequence(aPropertyHolders.Current()));
+                // the metafile size estimates the interpreted content well,
+                // its bitmaps end up in the primitives
+                const SolarMutexGuard aSolarGuard;
+                getMetafileDecompositionCache().put(aKey, xRetval, getMetaFile().GetSizeBytes());
+            }
 
             if(!xRetval.empty())
             {
@@ -23,6 +23,7 @@
 #include "editeng/unofield.hxx"
 #include "editeng/wghtitem.hxx"
 #include "editeng/postitem.hxx"
+#include "editeng/colritem.hxx"
 #include "editeng/section.hxx"
 #include "editeng/editobj.hxx"
 #include "editeng/flditem.hxx"
@@ -58,12 +59,19 @@ public:
 
     void testSectionAttributes();
 
+    /// Test that reused portion measurements match fresh ones
+    void testPortionMetricsCache();
+
+    void testPortionMetricsCacheCTL();
+
     CPPUNIT_TEST_SUITE(Test);
     CPPUNIT_TEST(testConstruction);
     CPPUNIT_TEST(testUnoTextFields);
     CPPUNIT_TEST(testAutocorrect);
     CPPUNIT_TEST(testHyperlinkSearch);
     CPPUNIT_TEST(testSectionAttributes);
+    CPPUNIT_TEST(testPortionMetricsCache);
+    CPPUNIT_TEST(testPortionMetricsCacheCTL);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -613,6 +621,82 @@ void Test::testSectionAttributes()
     }
 }
 
+void Test::testPortionMetricsCache()
+{
+    EditEngine aEngine(mpItemPool);
+
+    // The first paragraph is measured on the reference device, the second
+    // one has the same text and attributes and is served from the cache of
+    // portion measurements.
+    OUString aParaText = "Quick brown fox jumps over the lazy dog.";
+    aEngine.SetText(aParaText + "\n" + aParaText);
+    CPPUNIT_ASSERT_EQUAL(static_cast<sal_Int32>(2), aEngine.GetParagraphCount());
+
+    for (sal_Int32 i = 0; i < aParaText.getLength(); ++i)
+    {
+        Rectangle aFresh = aEngine.GetCharacterBounds(EPosition(0, i));
+        Rectangle aCached = aEngine.GetCharacterBounds(EPosition(1, i));
+        CPPUNIT_ASSERT_EQUAL(aFresh.Left(), aCached.Left());
+        CPPUNIT_ASSERT_EQUAL(aFresh.Right(), aCached.Right());
+    }
+}
+
+void Test::testPortionMetricsCacheCTL()
+{
+    // Arabic letters join with their neighbours, so the same portion text
+    // is shaped differently depending on the text around it. Each
+    // paragraph has a colored portion with the same text, that must not be
+    // measured like the one of the other paragraph.
+    const sal_Unicode aPortionChars[] = { 0x0628, 0x064A, 0x062A };
+    const OUString aPortion(aPortionChars, SAL_N_ELEMENTS(aPortionChars));
+    const OUString aKaf(sal_Unicode(0x0643));
+    const OUString aLam(sal_Unicode(0x0644));
+    const OUString aParaTexts[] = {
+        aKaf + aKaf + aPortion + aKaf,
+        aLam + aKaf + aPortion + aKaf,
+        aPortion
+    };
+    const sal_Int32 nParaCount = SAL_N_ELEMENTS(aParaTexts);
+
+    auto setText = [&](EditEngine& rEngine, sal_Int32 nFirst, sal_Int32 nCount)
+    {
+        OUString aText;
+        for (sal_Int32 i = 0; i < nCount; ++i)
+        {
+            if (i)
+                aText += "\n";
+            aText += aParaTexts[nFirst + i];
+        }
+        rEngine.SetText(aText);
+
+        SfxItemSet aSet(rEngine.GetEmptyItemSet());
+        aSet.Put(SvxColorItem(Color(COL_LIGHTRED), EE_CHAR_COLOR));
+        for (sal_Int32 i = 0; i < nCount; ++i)
+        {
+            const sal_Int32 nStart = aParaTexts[nFirst + i].indexOf(aPortion);
+            rEngine.QuickSetAttribs(aSet, ESelection(i, nStart, i, nStart + aPortion.getLength()));
+        }
+    };
+
+    EditEngine aEngine(mpItemPool);
+    setText(aEngine, 0, nParaCount);
+    CPPUNIT_ASSERT_EQUAL(nParaCount, aEngine.GetParagraphCount());
+
+    // every paragraph must be measured as by an engine of its own
+    for (sal_Int32 nPara = 0; nPara < nParaCount; ++nPara)
+    {
+        EditEngine aFreshEngine(mpItemPool);
+        setText(aFreshEngine, nPara, 1);
+        for (sal_Int32 i = 0; i < aParaTexts[nPara].getLength(); ++i)
+        {
+            Rectangle aFresh = aFreshEngine.GetCharacterBounds(EPosition(0, i));
+            Rectangle aShared = aEngine.GetCharacterBounds(EPosition(nPara, i));
+            CPPUNIT_ASSERT_EQUAL(aFresh.Left(), aShared.Left());
+            CPPUNIT_ASSERT_EQUAL(aFresh.Right(), aShared.Right());
+        }
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(Test);
 
 }
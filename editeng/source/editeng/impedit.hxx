@@ -58,6 +58,7 @@
 #include <LibreOfficeKit/LibreOfficeKitTypes.h>
 
 #include <boost/noncopyable.hpp>
+#include <o3tl/lru_map.hxx>
 #include <memory>
 #include <vector>
 
@@ -384,6 +385,50 @@ public:
 };
 
 
+/** Measurement of a text portion on the reference device
+
+    Reformatting a paragraph (e.g. after an attribute change elsewhere in
+    the document) measures all of its portions again, even when neither
+    the text nor the font did change. With simple text layout the result
+    only depends on the portion text and the state of the reference device,
+    so it is kept and reused by ImpEditEngine::GetPortionTextSize.
+ */
+struct TextPortionMetricsKey
+{
+    OUString                aText;          // text of the portion
+    vcl::Font               aFont;          // font at the reference device
+    OUString                aFontName;      // font actually used for it
+    MapMode                 aMapMode;
+    ComplexTextLayoutMode   nLayoutMode;
+    LanguageType            eDigitLanguage;
+    SvxCaseMap              eCaseMap;
+    short                   nKern;
+
+    bool operator==( const TextPortionMetricsKey& rOther ) const
+    {
+        return aText == rOther.aText
+            && nKern == rOther.nKern && eCaseMap == rOther.eCaseMap
+            && nLayoutMode == rOther.nLayoutMode && eDigitLanguage == rOther.eDigitLanguage
+            && aMapMode == rOther.aMapMode && aFont == rOther.aFont
+            && aFontName == rOther.aFontName;
+    }
+};
+
+struct TextPortionMetricsKeyHash
+{
+    size_t operator()( const TextPortionMetricsKey& rKey ) const
+    {
+        return rKey.aText.hashCode();
+    }
+};
+
+struct TextPortionMetrics
+{
+    Size                    aSize;
+    std::vector<long>       aDXArray;
+};
+
+
 //  ImpEditEngine
 
 
@@ -470,6 +515,10 @@ private:
     sal_uInt32          nCurTextHeightNTP;  // without trailing empty paragraphs
     sal_uInt16          nOnePixelInRef;
 
+    // Portion measurements of CreateLines, see TextPortionMetrics
+    typedef o3tl::lru_map< TextPortionMetricsKey, TextPortionMetrics, TextPortionMetricsKeyHash > TextPortionMetricsCache;
+    TextPortionMetricsCache aPortionMetricsCache;
+
     IdleFormattter      aIdleFormatter;
 
     Timer               aOnlineSpellTimer;
@@ -549,6 +598,7 @@ private:
     void                Clear();
     EditPaM             RemoveText();
     bool                CreateLines( sal_Int32 nPara, sal_uInt32 nStartPosY );
+    Size                GetPortionTextSize( const SvxFont& rFont, const OUString& rText, sal_Int32 nIndex, sal_Int32 nLen, long* pDXArray );
     void                CreateAndInsertEmptyLine( ParaPortion* pParaPortion, sal_uInt32 nStartPosY );
     bool                FinishCreateLines( ParaPortion* pParaPortion );
     void                CreateTextPortions( ParaPortion* pParaPortion, sal_Int32& rStartPos /*, sal_Bool bCreateBlockPortions */ );
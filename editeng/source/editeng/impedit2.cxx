@@ -87,6 +87,7 @@ ImpEditEngine::ImpEditEngine( EditEngine* pEE, SfxItemPool* pItemPool ) :
     aMaxAutoPaperSize( 0x7FFFFFFF, 0x7FFFFFFF ),
     aEditDoc( pItemPool ),
     aWordDelimiters(" .,;:-`'?!_=\"{}()[]"),
+    aPortionMetricsCache(4096),
     bKernAsianPunctuation(false),
     bAddExtLeading(false),
     bIsFormatting(false),
@@ -203,6 +204,8 @@ void ImpEditEngine::SetRefDevice( OutputDevice* pRef )
 
     nOnePixelInRef = (sal_uInt16)pRefDev->PixelToLogic( Size( 1, 0 ) ).Width();
 
+    aPortionMetricsCache.clear();
+
     if ( IsFormatted() )
     {
         FormatFullDoc();
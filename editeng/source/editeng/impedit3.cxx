@@ -76,6 +76,7 @@
 #include <comphelper/string.hxx>
 #include <comphelper/lok.hxx>
 #include <memory>
+#include <algorithm>
 
 using namespace ::com::sun::star;
 using namespace ::com::sun::star::uno;
@@ -594,6 +595,46 @@ static sal_Int32 ImplCalculateFontIndependentLineSpacing( const sal_Int32 nFontH
     return ( nFontHeight * 12 ) / 10;   // + 20%
 }
 
+Size ImpEditEngine::GetPortionTextSize( const SvxFont& rFont, const OUString& rText, sal_Int32 nIndex, sal_Int32 nLen, long* pDXArray )
+{
+    OutputDevice* pRefDevice = GetRefDevice();
+
+    // Complex scripts and bidirectional text are laid out together with
+    // the surrounding text of the paragraph (e.g. joining, mirroring), so
+    // their portions can't be measured in isolation and are not cached.
+    if ( ( nLen <= 0 ) || !pDXArray || !( pRefDevice->GetLayoutMode() & TEXT_LAYOUT_COMPLEX_DISABLED ) )
+        return rFont.QuickGetTextSize( pRefDevice, rText, nIndex, nLen, pDXArray );
+
+    // The physical font has been set at the reference device by the caller,
+    // together with layout and digit mode it determines the measurement. The
+    // font actually chosen for it is part of the key, so that a substitution
+    // that changes (e.g. after fonts were embedded) is not served stale.
+    TextPortionMetricsKey aKey;
+    aKey.aText = rText.copy( nIndex, nLen );
+    aKey.aFont = pRefDevice->GetFont();
+    aKey.aFontName = pRefDevice->GetFontMetric().GetFamilyName();
+    aKey.aMapMode = pRefDevice->GetMapMode();
+    aKey.nLayoutMode = pRefDevice->GetLayoutMode();
+    aKey.eDigitLanguage = pRefDevice->GetDigitLanguage();
+    aKey.eCaseMap = rFont.GetCaseMap();
+    aKey.nKern = rFont.GetFixKerning();
+
+    auto aIt = aPortionMetricsCache.find( aKey );
+    if ( aIt != aPortionMetricsCache.end() )
+    {
+        std::copy( aIt->second.aDXArray.begin(), aIt->second.aDXArray.end(), pDXArray );
+        return aIt->second.aSize;
+    }
+
+    std::pair<TextPortionMetricsKey, TextPortionMetrics> aEntry;
+    aEntry.first = aKey;
+    aEntry.second.aSize = rFont.QuickGetTextSize( pRefDevice, rText, nIndex, nLen, pDXArray );
+    aEntry.second.aDXArray.assign( pDXArray, pDXArray + nLen );
+    aPortionMetricsCache.insert( aEntry );
+
+    return aEntry.second.aSize;
+}
+
 bool ImpEditEngine::CreateLines( sal_Int32 nPara, sal_uInt32 nStartPosY )
 {
     ParaPortion* pParaPortion = GetParaPortions()[nPara];
@@ -1082,7 +1123,7 @@ bool ImpEditEngine::CreateLines( sal_Int32 nPara, sal_uInt32 nStartPosY )
 
                 if ( bCalcCharPositions || !pPortion->HasValidSize() )
                 {
-                    pPortion->GetSize() = aTmpFont.QuickGetTextSize( GetRefDevice(), pParaPortion->GetNode()->GetString(), nTmpPos, pPortion->GetLen(), pBuf.get() );
+                    pPortion->GetSize() = GetPortionTextSize( aTmpFont, pParaPortion->GetNode()->GetString(), nTmpPos, pPortion->GetLen(), pBuf.get() );
 
                     // #i9050# Do Kerning also behind portions...
                     if ( ( aTmpFont.GetFixKerning() > 0 ) && ( ( nTmpPos + pPortion->GetLen() ) < pNode->Len() ) )
@@ -34,6 +34,9 @@
 #include <comphelper/fileurl.hxx>
 #include <comphelper/processfactory.hxx>
 #include <comphelper/sequence.hxx>
+#include <osl/file.hxx>
+#include <rtl/instance.hxx>
+#include <o3tl/lru_map.hxx>
 
 #define DEBUG_TYPE_DETECTION 0
 
@@ -48,6 +51,90 @@ using namespace com::sun::star;
 namespace filter{
     namespace config{
 
+namespace {
+
+/** remembers the outcome of deep detections of unchanged local files.
+
+    The same file is often detected several times in a row (e.g. by the
+    loader and then again by the loaded document), and every time all
+    matching detect services would open and parse it again. Only detections
+    which did nothing but choose type and filter are remembered: whenever a
+    detect service substituted the stream, rewrote the URL, put component
+    data into the descriptor or recorded a decision of the user, the next
+    detection has to run for real again.
+ */
+class DetectionCache
+{
+    struct Entry
+    {
+        sal_uInt64 nSize;
+        TimeValue aModifyTime;
+        OUString sType;
+        /// everything the detection put into the media descriptor
+        comphelper::SequenceAsHashMap aResults;
+    };
+
+    static const size_t MAX_ENTRIES = 64;
+
+    ::osl::Mutex m_aMutex;
+    o3tl::lru_map< OUString, Entry, OUStringHash > m_aEntries;
+
+public:
+    DetectionCache()
+        : m_aEntries(MAX_ENTRIES)
+    {
+    }
+
+    bool get(const OUString& sURL, sal_uInt64 nSize, const TimeValue& aModifyTime,
+             OUString& sType, comphelper::SequenceAsHashMap& rResults)
+    {
+        ::osl::MutexGuard aGuard(m_aMutex);
+        auto pIt = m_aEntries.find(sURL);
+        if (pIt == m_aEntries.end() ||
+            pIt->second.nSize != nSize ||
+            pIt->second.aModifyTime.Seconds != aModifyTime.Seconds ||
+            pIt->second.aModifyTime.Nanosec != aModifyTime.Nanosec)
+            return false;
+        sType = pIt->second.sType;
+        rResults = pIt->second.aResults;
+        return true;
+    }
+
+    void put(const OUString& sURL, sal_uInt64 nSize, const TimeValue& aModifyTime,
+             const OUString& sType, const comphelper::SequenceAsHashMap& rResults)
+    {
+        std::pair< OUString, Entry > aPair(sURL, Entry());
+        aPair.second.nSize = nSize;
+        aPair.second.aModifyTime = aModifyTime;
+        aPair.second.sType = sType;
+        aPair.second.aResults = rResults;
+
+        ::osl::MutexGuard aGuard(m_aMutex);
+        // evicts the least recently used entry when full
+        m_aEntries.insert(aPair);
+    }
+};
+
+struct TheDetectionCache : public rtl::Static< DetectionCache, TheDetectionCache > {};
+
+/// size and modification time of a regular local file
+bool lcl_getFileStamp(const OUString& sURL, sal_uInt64& nSize, TimeValue& aModifyTime)
+{
+    if (!comphelper::isFileUrl(sURL))
+        return false;
+    osl::DirectoryItem aItem;
+    if (osl::DirectoryItem::get(sURL, aItem) != osl::FileBase::E_None)
+        return false;
+    osl::FileStatus aStatus(osl_FileStatus_Mask_Type | osl_FileStatus_Mask_FileSize | osl_FileStatus_Mask_ModifyTime);
+    if (aItem.getFileStatus(aStatus) != osl::FileBase::E_None || !aStatus.isRegular())
+        return false;
+    nSize = aStatus.getFileSize();
+    aModifyTime = aStatus.getModifyTime();
+    return true;
+}
+
+}
+
 TypeDetection::TypeDetection(const css::uno::Reference< css::uno::XComponentContext >& rxContext)
    : m_xContext(rxContext)
 {
@@ -374,6 +461,12 @@ OUString SAL_CALL TypeDetection::queryTypeByDescriptor(css::uno::Sequence< css::
     // make the descriptor more useable :-)
     utl::MediaDescriptor stlDescriptor(lDescriptor);
     OUString sType, sURL;
+    bool bCacheable = false;
+    bool bDetected = false;
+    sal_uInt64 nFileSize = 0;
+    TimeValue aModifyTime = { 0, 0 };
+    comphelper::SequenceAsHashMap aOriginalDescriptor;
+    css::uno::Reference< css::io::XInputStream > xOwnStream;
 
     try
     {
@@ -403,12 +496,45 @@ OUString SAL_CALL TypeDetection::queryTypeByDescriptor(css::uno::Sequence< css::
                 return stlDescriptor[utl::MediaDescriptor::PROP_TYPENAME()].get<OUString>();
         }
 
+        // results of an earlier detection of the very same local file can be reused,
+        // as long as the caller did not preselect anything or pass its own stream
+        // (the interaction handler of the loader is fine: detections asking the
+        // user leave more than type and filter behind and are never remembered)
+        bCacheable = bAllowDeep &&
+                     stlDescriptor.find(utl::MediaDescriptor::PROP_TYPENAME()) == stlDescriptor.end() &&
+                     stlDescriptor.find(utl::MediaDescriptor::PROP_DOCUMENTSERVICE()) == stlDescriptor.end() &&
+                     stlDescriptor.find(utl::MediaDescriptor::PROP_INPUTSTREAM()) == stlDescriptor.end() &&
+                     stlDescriptor.find(utl::MediaDescriptor::PROP_STREAM()) == stlDescriptor.end() &&
+                     lcl_getFileStamp(sURL, nFileSize, aModifyTime);
+        if (bCacheable)
+        {
+            comphelper::SequenceAsHashMap aResults;
+            if (TheDetectionCache::get().get(sURL, nFileSize, aModifyTime, sType, aResults))
+            {
+                aLock.clear();
+                stlDescriptor.update(aResults);
+                stlDescriptor >> lDescriptor;
+                return sType;
+            }
+            aOriginalDescriptor = stlDescriptor;
+        }
+
         FlatDetection lFlatTypes;
         impl_getAllFormatTypes(aURL, stlDescriptor, lFlatTypes);
 
         aLock.clear();
         // <- SAFE ----------------------------------
 
+        if (bCacheable)
+        {
+            // open the stream up front (as the first deep detection would do),
+            // so that detect services replacing it can be recognized below
+            impl_openStream(stlDescriptor);
+            xOwnStream = stlDescriptor.getUnpackedValueOrDefault(
+                utl::MediaDescriptor::PROP_INPUTSTREAM(),
+                css::uno::Reference< css::io::XInputStream >());
+        }
+
         // Properly prioritize all candidate types.
         lFlatTypes.sort(SortByPriority());
         lFlatTypes.unique(EqualByType());
@@ -425,6 +551,7 @@ OUString SAL_CALL TypeDetection::queryTypeByDescriptor(css::uno::Sequence< css::
         OUStringList lUsedDetectors;
         if (lFlatTypes.size()>0)
             sType = impl_detectTypeFlatAndDeep(stlDescriptor, lFlatTypes, bAllowDeep, lUsedDetectors, sLastChance);
+        bDetected = !sType.isEmpty();
 
 
         // flat detection failed
@@ -461,6 +588,38 @@ OUString SAL_CALL TypeDetection::queryTypeByDescriptor(css::uno::Sequence< css::
     impl_checkResultsAndAddBestFilter(stlDescriptor, sType); // Attention: sType is used as IN/OUT param here and will might be changed inside this method !!!
     impl_validateAndSetTypeOnDescriptor(stlDescriptor, sType);
 
+    // a detect service which substituted the stream (e.g. by a decompressed one)
+    // has to run again next time, the new stream can't be replayed
+    if (bCacheable && bDetected && !sType.isEmpty() &&
+        stlDescriptor.getUnpackedValueOrDefault(
+            utl::MediaDescriptor::PROP_INPUTSTREAM(),
+            css::uno::Reference< css::io::XInputStream >()) == xOwnStream)
+    {
+        // the opened stream is not worth keeping, the next loader opens its own
+        comphelper::SequenceAsHashMap aResults;
+        bool bReplayable = true;
+        for (auto const& rProp : stlDescriptor)
+        {
+            if (rProp.first == utl::MediaDescriptor::PROP_INPUTSTREAM() ||
+                rProp.first == utl::MediaDescriptor::PROP_STREAM())
+                continue;
+            auto pOriginal = aOriginalDescriptor.find(rProp.first);
+            if (pOriginal != aOriginalDescriptor.end() && pOriginal->second == rProp.second)
+                continue;
+            // anything else (URL, ComponentData, RepairPackage, ...) is bound to
+            // this very detection run or to an answer of the user
+            if (rProp.first != utl::MediaDescriptor::PROP_TYPENAME() &&
+                rProp.first != utl::MediaDescriptor::PROP_FILTERNAME())
+            {
+                bReplayable = false;
+                break;
+            }
+            aResults[rProp.first] = rProp.second;
+        }
+        if (bReplayable)
+            TheDetectionCache::get().put(sURL, nFileSize, aModifyTime, sType, aResults);
+    }
+
     stlDescriptor >> lDescriptor;
     return sType;
 }
@@ -69,6 +69,7 @@
 #include <com/sun/star/util/XModifyListener.hpp>
 
 #include <comphelper/configurationhelper.hxx>
+#include <comphelper/documentconstants.hxx>
 #include <cppuhelper/basemutex.hxx>
 #include <cppuhelper/exc_hlp.hxx>
 #include <cppuhelper/compbase.hxx>
@@ -950,6 +951,11 @@ private:
     /// TODO document me
     bool impl_enoughDiscSpace(sal_Int32 nRequiredSpace);
 
+    /** @short  check if the given filter stores in an own (ODF) format,
+                i.e. without losing anything of the document.
+     */
+    bool impl_isOwnFilter(const OUString& sFilter);
+
     /// TODO document me
     static void impl_showFullDiscError();
 
@@ -1041,6 +1047,7 @@ static const char CFG_ENTRY_PROP_ID[] = "ID";
 static const char CFG_ENTRY_PROP_VIEWNAMES[] = "ViewNames";
 
 static const char FILTER_PROP_TYPE[] = "Type";
+static const char FILTER_PROP_FLAGS[] = "Flags";
 static const char TYPE_PROP_EXTENSIONS[] = "Extensions";
 
 // setup.xcu
@@ -3112,6 +3119,7 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
     // If userautosave is enabled, first try to save the original file.
     // Note that we must do it *before* calling storeToRecoveryFile, so in case of failure here
     // we won't remain with the modified flag set to true, even though the autorecovery save succeeded.
+    bool bStoredToOriginal = false;
     try
     {
         // We must check here for an empty URL to avoid a "This operation is not supported on this operating system."
@@ -3120,53 +3128,66 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
         {
             Reference< XStorable > xDocSave(rInfo.Document, css::uno::UNO_QUERY_THROW);
             xDocSave->store();
+            // Only a store in the own format is lossless; a document in an
+            // alien format still needs its recovery copy in ODF.
+            bStoredToOriginal = !xDocRecover->wasModifiedSinceLastSave()
+                && impl_isOwnFilter(lOldArgs.getUnpackedValueOrDefault(utl::MediaDescriptor::PROP_FILTERNAME(), OUString()));
         }
     }
     catch(const css::uno::Exception&)
     {
     }
 
-    sal_Int32 nRetry = RETRY_STORE_ON_FULL_DISC_FOREVER;
+    // The original ODF file is up to date now, so it is the recovery source
+    // itself - exactly as for documents which were not modified at all.
+    // Storing the very same state a second time as backup would only
+    // double the time the UI is blocked.
     bool  bError = false;
-    do
+    if (bStoredToOriginal)
+        rInfo.NewTempURL.clear();
+    else
     {
-        try
+        sal_Int32 nRetry = RETRY_STORE_ON_FULL_DISC_FOREVER;
+        do
         {
-            xDocRecover->storeToRecoveryFile( rInfo.NewTempURL, lNewArgs.getAsConstPropertyValueList() );
+            try
+            {
+                xDocRecover->storeToRecoveryFile( rInfo.NewTempURL, lNewArgs.getAsConstPropertyValueList() );
 
 #ifdef TRIGGER_FULL_DISC_CHECK
-            throw css::uno::Exception();
+                throw css::uno::Exception();
 #else  // TRIGGER_FULL_DISC_CHECK
 
-            bError = false;
-            nRetry = 0;
+                bError = false;
+                nRetry = 0;
 #endif // TRIGGER_FULL_DISC_CHECK
-        }
-        catch(const css::uno::Exception&)
-        {
-            bError = true;
+            }
+            catch(const css::uno::Exception&)
+            {
+                bError = true;
 
-            // a) FULL DISC seems to be the problem behind                              => show error and retry it forever (e.g. retry=300)
-            // b) unknown problem (may be locking problem)                              => reset RETRY value to more useful value(!) (e.g. retry=3)
-            // c) unknown problem (may be locking problem) + 1..2 repeating operations  => throw the original exception to force generation of a stacktrace !
+                // a) FULL DISC seems to be the problem behind                              => show error and retry it forever (e.g. retry=300)
+                // b) unknown problem (may be locking problem)                              => reset RETRY value to more useful value(!) (e.g. retry=3)
+                // c) unknown problem (may be locking problem) + 1..2 repeating operations  => throw the original exception to force generation of a stacktrace !
 
-            sal_Int32 nMinSpaceDocSave;
-            /* SAFE */ {
-            osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
-            nMinSpaceDocSave = m_nMinSpaceDocSave;
-            } /* SAFE */
+                sal_Int32 nMinSpaceDocSave;
+                /* SAFE */ {
+                osl::MutexGuard g(cppu::WeakComponentImplHelperBase::rBHelper.rMutex);
+                nMinSpaceDocSave = m_nMinSpaceDocSave;
+                } /* SAFE */
 
-            if (! impl_enoughDiscSpace(nMinSpaceDocSave))
-                AutoRecovery::impl_showFullDiscError();
-            else if (nRetry > RETRY_STORE_ON_MIGHT_FULL_DISC_USEFULL)
-                nRetry = RETRY_STORE_ON_MIGHT_FULL_DISC_USEFULL;
-            else if (nRetry <= GIVE_UP_RETRY)
-                throw; // force stacktrace to know if there exist might other reasons, why an AutoSave can fail !!!
+                if (! impl_enoughDiscSpace(nMinSpaceDocSave))
+                    AutoRecovery::impl_showFullDiscError();
+                else if (nRetry > RETRY_STORE_ON_MIGHT_FULL_DISC_USEFULL)
+                    nRetry = RETRY_STORE_ON_MIGHT_FULL_DISC_USEFULL;
+                else if (nRetry <= GIVE_UP_RETRY)
+                    throw; // force stacktrace to know if there exist might other reasons, why an AutoSave can fail !!!
 
-            --nRetry;
+                --nRetry;
+            }
         }
+        while(nRetry>0);
     }
-    while(nRetry>0);
 
     if (! bError)
     {
@@ -4160,6 +4181,26 @@ void AutoRecovery::implts_verifyCacheAgainstDesktopDocumentList()
     SAL_INFO("fwk.autorecovery", "... AutoRecovery::implts_verifyCacheAgainstDesktopDocumentList()");
 }
 
+bool AutoRecovery::impl_isOwnFilter(const OUString& sFilter)
+{
+    if (sFilter.isEmpty())
+        return false;
+
+    try
+    {
+        css::uno::Reference< css::container::XNameAccess > xFilterCFG(
+                m_xContext->getServiceManager()->createInstanceWithContext(
+                    "com.sun.star.document.FilterFactory", m_xContext), css::uno::UNO_QUERY_THROW);
+        ::comphelper::SequenceAsHashMap lFilterProps(xFilterCFG->getByName(sFilter));
+        SfxFilterFlags nFlags = static_cast< SfxFilterFlags >(lFilterProps.getUnpackedValueOrDefault(FILTER_PROP_FLAGS, sal_Int32(0)));
+        return (nFlags & SfxFilterFlags::OWN) && !(nFlags & SfxFilterFlags::ALIEN);
+    }
+    catch(const css::uno::Exception&)
+    {
+    }
+    return false;
+}
+
 bool AutoRecovery::impl_enoughDiscSpace(sal_Int32 nRequiredSpace)
 {
 #ifdef SIMULATE_FULL_DISC
@@ -189,6 +189,8 @@ private:
 
     // a unique increasing ID to be able to say which data change is older
     sal_uLong               mnDataChangeTimeStamp;
+    // a unique increasing ID to be able to say which graphic was used least recently
+    sal_uLong               mnLastUseTimeStamp;
 
     bool                    mbAutoSwapped   : 1;
     bool                    mbTransparent   : 1;
@@ -502,6 +504,7 @@ public:
 
     // read access
     sal_uLong GetDataChangeTimeStamp() const { return mnDataChangeTimeStamp; }
+    sal_uLong GetLastUseTimeStamp() const { return mnLastUseTimeStamp; }
 };
 
 typedef ::std::vector< GraphicObject* > GraphicObjectList_impl;
@@ -595,7 +598,7 @@ private:
     // to solve is that normally the SwapOut is timer-driven, but even with short timer settings there are situations
     // where this does not trigger - or in other words: A maximum limitation for GraphicManagers was not in place before.
     // For 32Bit systems this leads to situations where graphics will be missing. This method will actively swap out
-    // the longest swapped in graphics until a maximum memory boundary (derived from user settings in tools/options/memory)
+    // the least recently used graphics until a maximum memory boundary (derived from user settings in tools/options/memory)
     // is no longer exceeded
     void SVT_DLLPRIVATE ImplCheckSizeOfSwappedInGraphics(const GraphicObject* pGraphicToIgnore);
 public:
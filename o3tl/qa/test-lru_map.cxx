@@ -27,6 +27,7 @@ public:
     void testReplaceValue();
     void testLruRemoval();
     void testCustomHash();
+    void testClear();
 
     CPPUNIT_TEST_SUITE(lru_map_test);
     CPPUNIT_TEST(testBaseUsage);
@@ -34,6 +35,7 @@ public:
     CPPUNIT_TEST(testReplaceValue);
     CPPUNIT_TEST(testLruRemoval);
     CPPUNIT_TEST(testCustomHash);
+    CPPUNIT_TEST(testClear);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -234,6 +236,28 @@ void lru_map_test::testCustomHash()
     CPPUNIT_ASSERT_EQUAL(13, lru.find(TestClassKey(2,1))->second);
 }
 
+void lru_map_test::testClear()
+{
+    o3tl::lru_map<int, int> lru(2);
+
+    lru.insert(std::make_pair<int, int>(1, 1));
+    lru.insert(std::make_pair<int, int>(2, 2));
+    CPPUNIT_ASSERT_EQUAL(size_t(2), lru.size());
+
+    lru.clear();
+    CPPUNIT_ASSERT_EQUAL(size_t(0), lru.size());
+    CPPUNIT_ASSERT(lru.end() == lru.find(1));
+    CPPUNIT_ASSERT(lru.end() == lru.find(2));
+
+    // still usable up to its capacity
+    lru.insert(std::make_pair<int, int>(3, 3));
+    lru.insert(std::make_pair<int, int>(4, 4));
+    lru.insert(std::make_pair<int, int>(5, 5));
+    CPPUNIT_ASSERT_EQUAL(size_t(2), lru.size());
+    CPPUNIT_ASSERT(lru.end() == lru.find(3));
+    CPPUNIT_ASSERT_EQUAL(5, lru.find(5)->second);
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(lru_map_test);
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
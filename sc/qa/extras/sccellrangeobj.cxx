@@ -16,6 +16,9 @@
 
 #include <com/sun/star/sheet/XSpreadsheetDocument.hpp>
 #include <com/sun/star/sheet/XSpreadsheet.hpp>
+#include <com/sun/star/sheet/XCellRangeData.hpp>
+#include <com/sun/star/table/CellContentType.hpp>
+#include <com/sun/star/table/XCell.hpp>
 #include <com/sun/star/table/XCellRange.hpp>
 
 using namespace css;
@@ -23,7 +26,7 @@ using namespace css::uno;
 
 namespace sc_apitest {
 
-#define NUMBER_OF_TESTS 14
+#define NUMBER_OF_TESTS 15
 
 class ScCellRangeObj : public CalcUnoApiTest, public apitest::XCellRangesQuery, public apitest::CellProperties,
                         public apitest::XSearchable, public apitest::XReplaceable, public apitest::XCellRangeData
@@ -36,6 +39,8 @@ public:
     virtual uno::Reference< uno::XInterface > init() override;
     virtual uno::Reference< uno::XInterface > getXCellRangeData() override;
 
+    void testSetDataArrayMixed();
+
     CPPUNIT_TEST_SUITE(ScCellRangeObj);
     CPPUNIT_TEST(testQueryColumnDifference);
     CPPUNIT_TEST(testQueryContentDifference);
@@ -52,6 +57,7 @@ public:
     CPPUNIT_TEST(testCreateReplaceDescriptor);
     CPPUNIT_TEST(testGetDataArray);
     CPPUNIT_TEST(testSetDataArray);
+    CPPUNIT_TEST(testSetDataArrayMixed);
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -109,6 +115,68 @@ uno::Reference< uno::XInterface > ScCellRangeObj::getXCellRangeData()
     return xReturn;
 }
 
+void ScCellRangeObj::testSetDataArrayMixed()
+{
+    // loads the document if needed
+    getXCellRangeData();
+    uno::Reference< sheet::XSpreadsheetDocument> xDoc (mxComponent, UNO_QUERY_THROW);
+    uno::Reference< container::XIndexAccess > xIndex (xDoc->getSheets(), UNO_QUERY_THROW);
+    uno::Reference< sheet::XSpreadsheet > xSheet( xIndex->getByIndex(1), UNO_QUERY_THROW);
+
+    // formulas depending on the range F10:H13
+    xSheet->getCellByPosition(9, 9)->setFormula("=SUM(F10:F13)");
+    xSheet->getCellByPosition(9, 10)->setFormula("=SUM(H10:H13)");
+    CPPUNIT_ASSERT_EQUAL(0.0, xSheet->getCellByPosition(9, 9)->getValue());
+
+    // numbers of different types, strings and void mixed in one column,
+    // with a row that is too short
+    uno::Sequence< uno::Sequence< uno::Any > > aData(4);
+    aData[0].realloc(3);
+    aData[0][0] <<= 1.0;
+    aData[0][1] <<= OUString("a");
+    aData[0][2] <<= 2.0;
+    aData[1].realloc(3);
+    aData[1][0] <<= sal_Int32(3);
+    aData[1][2] <<= 4.0;
+    aData[2].realloc(1);
+    aData[2][0] <<= 5.0;
+    aData[3].realloc(3);
+    aData[3][0] <<= 6.0;
+    aData[3][1] <<= 7.0;
+    aData[3][2] <<= OUString("b");
+
+    uno::Reference< sheet::XCellRangeData > xCellRangeData(
+        xSheet->getCellRangeByPosition(5, 9, 7, 12), UNO_QUERY_THROW);
+    bool bThrown = false;
+    try
+    {
+        xCellRangeData->setDataArray(aData);
+    }
+    catch (const uno::RuntimeException&)
+    {
+        // the short row is reported, the other rows are put nevertheless
+        bThrown = true;
+    }
+    CPPUNIT_ASSERT(bThrown);
+
+    CPPUNIT_ASSERT_EQUAL(1.0, xSheet->getCellByPosition(5, 9)->getValue());
+    CPPUNIT_ASSERT_EQUAL(OUString("a"), xSheet->getCellByPosition(6, 9)->getFormula());
+    CPPUNIT_ASSERT_EQUAL(2.0, xSheet->getCellByPosition(7, 9)->getValue());
+    CPPUNIT_ASSERT_EQUAL(3.0, xSheet->getCellByPosition(5, 10)->getValue());
+    // void is "no value"
+    CPPUNIT_ASSERT(xSheet->getCellByPosition(6, 10)->getError() != 0);
+    CPPUNIT_ASSERT_EQUAL(4.0, xSheet->getCellByPosition(7, 10)->getValue());
+    for (sal_Int32 nCol = 5; nCol <= 7; ++nCol)
+        CPPUNIT_ASSERT_EQUAL(table::CellContentType_EMPTY, xSheet->getCellByPosition(nCol, 11)->getType());
+    CPPUNIT_ASSERT_EQUAL(6.0, xSheet->getCellByPosition(5, 12)->getValue());
+    CPPUNIT_ASSERT_EQUAL(7.0, xSheet->getCellByPosition(6, 12)->getValue());
+    CPPUNIT_ASSERT_EQUAL(OUString("b"), xSheet->getCellByPosition(7, 12)->getFormula());
+
+    // the dependent formulas are recalculated
+    CPPUNIT_ASSERT_EQUAL(10.0, xSheet->getCellByPosition(9, 9)->getValue());
+    CPPUNIT_ASSERT_EQUAL(6.0, xSheet->getCellByPosition(9, 10)->getValue());
+}
+
 void ScCellRangeObj::setUp()
 {
     nTest++;
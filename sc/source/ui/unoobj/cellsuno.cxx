@@ -131,6 +131,7 @@
 
 #include <list>
 #include <memory>
+#include <vector>
 
 using namespace com::sun::star;
 
@@ -1127,6 +1128,21 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
 
     rDoc.DeleteAreaTab( nStartCol, nStartRow, nEndCol, nEndRow, nTab, InsertDeleteFlags::CONTENTS );
 
+    //  Numbers are collected into runs per column and put in one go, as the
+    //  area is empty now and setting them one by one costs a cell store
+    //  lookup and a broadcast per cell.
+    std::vector< std::vector<double> > aValueRuns( nCols );
+    std::vector<SCROW> aValueRunStarts( nCols, nStartRow );
+    auto flushValues = [&]( long nCol )
+    {
+        std::vector<double>& rRun = aValueRuns[nCol];
+        if ( !rRun.empty() )
+        {
+            rDoc.SetValues( ScAddress( nStartCol + nCol, aValueRunStarts[nCol], nTab ), rRun );
+            rRun.clear();
+        }
+    };
+
     bool bError = false;
     SCROW nDocRow = nStartRow;
     for (long nRow=0; nRow<nRows; nRow++)
@@ -1146,6 +1162,7 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
                     case uno::TypeClass_VOID:
                     {
                         // void = "no value"
+                        flushValues( nCol );
                         rDoc.SetError( nDocCol, nDocRow, nTab, NOTAVAILABLE );
                     }
                     break;
@@ -1162,12 +1179,15 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
                     {
                         double fVal(0.0);
                         rElement >>= fVal;
-                        rDoc.SetValue(aPos, fVal);
+                        if ( aValueRuns[nCol].empty() )
+                            aValueRunStarts[nCol] = nDocRow;
+                        aValueRuns[nCol].push_back( fVal );
                     }
                     break;
 
                     case uno::TypeClass_STRING:
                     {
+                        flushValues( nCol );
                         OUString aUStr;
                         rElement >>= aUStr;
                         if ( !aUStr.isEmpty() )
@@ -1182,6 +1202,7 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
                     // accept Sequence<FormulaToken> for formula cells
                     case uno::TypeClass_SEQUENCE:
                     {
+                        flushValues( nCol );
                         uno::Sequence< sheet::FormulaToken > aTokens;
                         if ( rElement >>= aTokens )
                         {
@@ -1195,16 +1216,23 @@ static bool lcl_PutDataArray( ScDocShell& rDocShell, const ScRange& rRange,
                     break;
 
                     default:
+                        flushValues( nCol );
                         bError = true;      // invalid type
                 }
                 ++nDocCol;
             }
         }
         else
+        {
+            for (long nCol=0; nCol<nCols; nCol++)
+                flushValues( nCol );
             bError = true;                          // wrong size
+        }
 
         ++nDocRow;
     }
+    for (long nCol=0; nCol<nCols; nCol++)
+        flushValues( nCol );
 
     bool bHeight = rDocShell.AdjustRowHeight( nStartRow, nEndRow, nTab );
 
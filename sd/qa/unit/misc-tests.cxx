@@ -31,6 +31,14 @@
 #include <controller/SlideSorterController.hxx>
 #include <controller/SlsClipboard.hxx>
 #include <controller/SlsPageSelector.hxx>
+#include <unomodel.hxx>
+#include <drawdoc.hxx>
+#include <sdpage.hxx>
+#include <SlsQueueProcessor.hxx>
+#include <SlsRequestQueue.hxx>
+#include <SlsBitmapCache.hxx>
+
+#include <com/sun/star/drawing/XDrawPages.hpp>
 
 using namespace ::com::sun::star;
 
@@ -40,16 +48,51 @@ class SdMiscTest : public SdModelTestBase
 public:
     void testTdf96206();
     void testTdf96708();
+    void testPreviewQueueProcessing();
 
     CPPUNIT_TEST_SUITE(SdMiscTest);
     CPPUNIT_TEST(testTdf96206);
     CPPUNIT_TEST(testTdf96708);
+    CPPUNIT_TEST(testPreviewQueueProcessing);
     CPPUNIT_TEST_SUITE_END();
 
 private:
     sd::DrawDocShellRef Load(const OUString& rURL, sal_Int32 nFormat);
+    std::vector<int> CreatePreviews(SdDrawDocument* pDoc, bool bVisible);
+};
+
+namespace {
+
+/// Records in which timer tick each preview was created.
+class PreviewTickContext : public sd::slidesorter::cache::CacheContext
+{
+public:
+    PreviewTickContext(bool bVisible, const int& rTick)
+        : mbVisible(bVisible), mrTick(rTick) {}
+
+    virtual void NotifyPreviewCreation(sd::slidesorter::cache::CacheKey, const Bitmap&) override
+    {
+        maCreationTicks.push_back(mrTick);
+    }
+    virtual bool IsIdle() override { return true; }
+    virtual bool IsVisible(sd::slidesorter::cache::CacheKey) override { return mbVisible; }
+    virtual const SdrPage* GetPage(sd::slidesorter::cache::CacheKey aKey) override { return aKey; }
+    virtual std::shared_ptr<std::vector<sd::slidesorter::cache::CacheKey> > GetEntryList(bool) override
+    {
+        return std::shared_ptr<std::vector<sd::slidesorter::cache::CacheKey> >();
+    }
+    virtual sal_Int32 GetPriority(sd::slidesorter::cache::CacheKey) override { return 0; }
+    virtual uno::Reference<uno::XInterface> GetModel() override { return uno::Reference<uno::XInterface>(); }
+
+    std::vector<int> maCreationTicks;
+
+private:
+    bool mbVisible;
+    const int& mrTick;
 };
 
+}
+
 sd::DrawDocShellRef SdMiscTest::Load(const OUString& rURL, sal_Int32 nFormat)
 {
     uno::Reference< frame::XDesktop2 > xDesktop = frame::Desktop::create(::comphelper::getProcessComponentContext());
@@ -137,6 +180,60 @@ void SdMiscTest::testTdf96708()
     xDocSh->DoClose();
 }
 
+std::vector<int> SdMiscTest::CreatePreviews(SdDrawDocument* pDoc, bool bVisible)
+{
+    using namespace sd::slidesorter::cache;
+
+    int nTick = 0;
+    std::shared_ptr<PreviewTickContext> pContext(new PreviewTickContext(bVisible, nTick));
+    RequestQueue aQueue(pContext);
+    for (sal_uInt16 i = 0; i < pDoc->GetSdPageCount(PK_STANDARD); ++i)
+        aQueue.AddRequest(pDoc->GetSdPage(i, PK_STANDARD), bVisible ? VISIBLE_NO_PREVIEW : NOT_VISIBLE);
+
+    QueueProcessor aProcessor(aQueue, std::make_shared<BitmapCache>(), Size(100, 75), false, pContext);
+    // a time slice that even a slow machine does not use up
+    aProcessor.SetTimeSliceForVisibleRequests(60000);
+    aProcessor.Start(bVisible ? 0 : 1);
+    for (nTick = 1; nTick <= 20 && !aQueue.IsEmpty(); ++nTick)
+    {
+        // longer than the timeout for high or low priority requests
+        TimeValue aSleep(0, (bVisible ? 20 : 110) * 1000000);
+        osl::Thread::wait(aSleep);
+        Scheduler::ProcessTaskScheduling(true);
+    }
+    aProcessor.Stop();
+    CPPUNIT_ASSERT(aQueue.IsEmpty());
+
+    return pContext->maCreationTicks;
+}
+
+void SdMiscTest::testPreviewQueueProcessing()
+{
+    uno::Reference<lang::XComponent> xComponent = loadFromDesktop("private:factory/simpress", "com.sun.star.presentation.PresentationDocument");
+    SdXImpressDocument* pImpressDocument = dynamic_cast<SdXImpressDocument*>(xComponent.get());
+    CPPUNIT_ASSERT(pImpressDocument);
+    uno::Reference<drawing::XDrawPages> xDrawPages = pImpressDocument->getDrawPages();
+    for (int i = 0; i < 3; ++i)
+        xDrawPages->insertNewByIndex(0);
+    SdDrawDocument* pDoc = pImpressDocument->GetDoc();
+    CPPUNIT_ASSERT_EQUAL(sal_uInt16(4), pDoc->GetSdPageCount(PK_STANDARD));
+
+    // Previews of visible slides are created in a batch: all of them
+    // within the time slice of one tick.
+    std::vector<int> aTicks = CreatePreviews(pDoc, true);
+    CPPUNIT_ASSERT_EQUAL(size_t(4), aTicks.size());
+    for (size_t i = 1; i < aTicks.size(); ++i)
+        CPPUNIT_ASSERT_EQUAL(aTicks[0], aTicks[i]);
+
+    // Previews of slides that are not visible are created one per tick.
+    aTicks = CreatePreviews(pDoc, false);
+    CPPUNIT_ASSERT_EQUAL(size_t(4), aTicks.size());
+    for (size_t i = 1; i < aTicks.size(); ++i)
+        CPPUNIT_ASSERT(aTicks[i - 1] < aTicks[i]);
+
+    xComponent->dispose();
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(SdMiscTest);
 
 CPPUNIT_PLUGIN_IMPLEMENT();
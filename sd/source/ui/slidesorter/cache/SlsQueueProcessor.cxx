@@ -21,6 +21,8 @@
 #include "SlsCacheConfiguration.hxx"
 #include "SlsRequestQueue.hxx"
 
+#include <tools/time.hxx>
+
 namespace sd { namespace slidesorter { namespace cache {
 
 //=====  QueueProcessor  ======================================================
@@ -36,6 +38,7 @@ QueueProcessor::QueueProcessor (
       mnTimeBetweenHighPriorityRequests (10/*ms*/),
       mnTimeBetweenLowPriorityRequests (100/*ms*/),
       mnTimeBetweenRequestsWhenNotIdle (1000/*ms*/),
+      mnTimeSliceForVisibleRequests (50/*ms*/),
       maPreviewSize(rPreviewSize),
       mbDoSuperSampling(bDoSuperSampling),
       mpCacheContext(rpCacheContext),
@@ -58,6 +61,11 @@ QueueProcessor::QueueProcessor (
     if (aTimeBetweenReqeusts.has<sal_Int32>())
         aTimeBetweenReqeusts >>= mnTimeBetweenRequestsWhenNotIdle;
 
+    css::uno::Any aTimeSlice;
+    aTimeSlice = CacheConfiguration::Instance()->GetValue("TimeSliceForVisibleRequests");
+    if (aTimeSlice.has<sal_Int32>())
+        aTimeSlice >>= mnTimeSliceForVisibleRequests;
+
     maTimer.SetTimeoutHdl (LINK(this,QueueProcessor,ProcessRequestHdl));
     maTimer.SetTimeout (10);
 }
@@ -73,9 +81,9 @@ void QueueProcessor::Start (int nPriorityClass)
     if ( ! maTimer.IsActive())
     {
         if (nPriorityClass == 0)
-            maTimer.SetTimeout (10);
+            maTimer.SetTimeout (mnTimeBetweenHighPriorityRequests);
         else
-            maTimer.SetTimeout (100);
+            maTimer.SetTimeout (mnTimeBetweenLowPriorityRequests);
         maTimer.Start();
     }
 }
@@ -98,6 +106,11 @@ void QueueProcessor::Resume()
         Start(mrQueue.GetFrontPriorityClass());
 }
 
+void QueueProcessor::SetTimeSliceForVisibleRequests (const sal_uInt32 nTimeSlice)
+{
+    mnTimeSliceForVisibleRequests = nTimeSlice;
+}
+
 void QueueProcessor::SetPreviewSize (
     const Size& rPreviewSize,
     const bool bDoSuperSampling)
@@ -115,9 +128,13 @@ void QueueProcessor::ProcessRequests()
 {
     OSL_ASSERT(mpCacheContext.get()!=nullptr);
 
-    // Never process more than one request at a time in order to prevent the
-    // lock up of the edit view.
-    if ( ! mrQueue.IsEmpty()
+    // Previews of visible slides are processed in a batch, bounded by a time
+    // slice and by the user becoming active, instead of waiting for the
+    // timer between each of them.  Previews of slides that are not visible
+    // are still created one at a time in order to prevent the lock up of
+    // the edit view.
+    const sal_uInt64 nStartTime (tools::Time::GetSystemTicks());
+    while ( ! mrQueue.IsEmpty()
         && ! mbIsPaused
         &&  mpCacheContext->IsIdle())
     {
@@ -137,6 +154,10 @@ void QueueProcessor::ProcessRequests()
 
         if (aKey != nullptr)
             ProcessOneRequest(aKey, ePriorityClass);
+
+        if (ePriorityClass == NOT_VISIBLE
+            || tools::Time::GetSystemTicks() - nStartTime >= mnTimeSliceForVisibleRequests)
+            break;
     }
 
     // Schedule the processing of the next element(s).
@@ -75,6 +75,12 @@ public:
     void Pause();
     void Resume();
 
+    /** Set the maximal time in ms that one timer call spends on creating
+        previews of visible slides.  The default can be overridden by the
+        TimeSliceForVisibleRequests configuration value.
+    */
+    void SetTimeSliceForVisibleRequests (const sal_uInt32 nTimeSlice);
+
     void SetPreviewSize (
         const Size& rSize,
         const bool bDoSuperSampling);
@@ -96,6 +102,10 @@ private:
     sal_uInt32 mnTimeBetweenHighPriorityRequests;
     sal_uInt32 mnTimeBetweenLowPriorityRequests;
     sal_uInt32 mnTimeBetweenRequestsWhenNotIdle;
+    /** Maximal time in ms that one timer call spends on creating previews
+        of visible slides before giving control back to the main loop.
+    */
+    sal_uInt32 mnTimeSliceForVisibleRequests;
     Size maPreviewSize;
     bool mbDoSuperSampling;
     SharedCacheContext mpCacheContext;
@@ -104,6 +114,10 @@ private:
     BitmapFactory maBitmapFactory;
     bool mbIsPaused;
 
+    /** Process the requests at the front of the queue.  Requests for
+        visible slides are processed in a batch until the time slice is
+        used up or the user becomes active, others one at a time.
+    */
     void ProcessRequests();
     void ProcessOneRequest (
         CacheKey aKey,
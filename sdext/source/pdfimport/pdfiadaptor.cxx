@@ -249,6 +249,9 @@ bool PDFIRawAdaptor::parse( const uno::Reference<io::XInputStream>&       xInput
     if( m_bEnableToplevelText )
         pSink->enableToplevelText();
 
+    // optimize pages while the document is still being parsed
+    pSink->setTreeVisitorFactory(m_pVisitorFactory);
+
     bool bSuccess=false;
 
     if( xInput.is() )
@@ -24,11 +24,14 @@
 #include "pdfihelper.hxx"
 #include "wrapper.hxx"
 #include "pdfparse.hxx"
+#include "odfemitter.hxx"
 #include "../pdfiadaptor.hxx"
+#include "../tree/pdfiprocessor.hxx"
 
 #include <rtl/math.hxx>
 #include <osl/file.hxx>
 #include <comphelper/sequence.hxx>
+#include <cppuhelper/implbase.hxx>
 
 #include "cppunit/TestAssert.h"
 #include "cppunit/TestFixture.h"
@@ -41,6 +44,7 @@
 #include <com/sun/star/rendering/PathJoinType.hpp>
 #include <com/sun/star/rendering/PathCapType.hpp>
 #include <com/sun/star/rendering/BlendMode.hpp>
+#include <com/sun/star/io/XOutputStream.hpp>
 
 #include <basegfx/matrix/b2dhommatrix.hxx>
 #include <basegfx/tools/canvastools.hxx>
@@ -450,6 +454,54 @@ namespace
         bool                      m_bImageSeen;
     };
 
+    /// collects the emitted document in memory
+    class OutputCollector : public cppu::WeakImplHelper< io::XOutputStream >
+    {
+        std::vector<sal_Int8>& m_rData;
+
+    public:
+        explicit OutputCollector( std::vector<sal_Int8>& rData ) : m_rData(rData) {}
+
+        virtual void SAL_CALL writeBytes( const uno::Sequence< sal_Int8 >& aData ) throw (io::NotConnectedException, io::BufferSizeExceededException, io::IOException, uno::RuntimeException, std::exception) override
+        {
+            m_rData.insert( m_rData.end(), aData.begin(), aData.end() );
+        }
+
+        virtual void SAL_CALL flush() throw (io::NotConnectedException, io::BufferSizeExceededException, io::IOException, uno::RuntimeException, std::exception) override
+        {
+        }
+
+        virtual void SAL_CALL closeOutput() throw (io::NotConnectedException, io::BufferSizeExceededException, io::IOException, uno::RuntimeException, std::exception) override
+        {
+        }
+    };
+
+    /// feed a few pages of text and links into the sink, like the parser would
+    void fillPages( ContentSink& rSink )
+    {
+        const sal_Int32 nPages = 3;
+        rSink.setPageNum( nPages );
+        for( sal_Int32 nPage = 0; nPage < nPages; ++nPage )
+        {
+            rSink.startPage( geometry::RealSize2D( 500, 500 ) );
+            for( sal_Int32 nLine = 0; nLine < 3; ++nLine )
+            {
+                const OUString aText( "Page text" );
+                const double fY = 100 + 20 * nLine;
+                for( sal_Int32 i = 0; i < aText.getLength(); ++i )
+                    rSink.drawGlyphs( aText.copy( i, 1 ),
+                                      geometry::RealRectangle2D( 50 + 6 * i, fY, 56 + 6 * i, fY + 12 ),
+                                      geometry::Matrix2D( 1, 0, 0, 1 ),
+                                      12 );
+                rSink.endText();
+            }
+            rSink.endPage();
+            // links of a page are reported after its end
+            rSink.hyperLink( geometry::RealRectangle2D( 50, 100, 100, 112 ),
+                             "http://www.libreoffice.org/" );
+        }
+    }
+
     class PDFITest : public test::BootstrapFixture
     {
     public:
@@ -496,10 +548,35 @@ namespace
             osl::File::remove( tempFileURL );
         }
 
+        void checkPageOptimization( const TreeVisitorFactorySharedPtr& pFactory )
+        {
+            std::vector<sal_Int8> aWhole, aPagewise;
+
+            PDFIProcessor aWholeSink( uno::Reference< task::XStatusIndicator >(), getComponentContext() );
+            fillPages( aWholeSink );
+            aWholeSink.emit( *createOdfEmitter( new OutputCollector(aWhole) ), *pFactory );
+
+            PDFIProcessor aPagewiseSink( uno::Reference< task::XStatusIndicator >(), getComponentContext() );
+            aPagewiseSink.setTreeVisitorFactory( pFactory );
+            fillPages( aPagewiseSink );
+            aPagewiseSink.emit( *createOdfEmitter( new OutputCollector(aPagewise) ), *pFactory );
+
+            // optimizing page by page while parsing must not change the result
+            CPPUNIT_ASSERT( !aWhole.empty() );
+            CPPUNIT_ASSERT( aWhole == aPagewise );
+        }
+
+        void testPageOptimization()
+        {
+            checkPageOptimization( createDrawTreeVisitorFactory() );
+            checkPageOptimization( createWriterTreeVisitorFactory() );
+        }
+
         CPPUNIT_TEST_SUITE(PDFITest);
         CPPUNIT_TEST(testXPDFParser);
         CPPUNIT_TEST(testOdfWriterExport);
         CPPUNIT_TEST(testOdfDrawExport);
+        CPPUNIT_TEST(testPageOptimization);
         CPPUNIT_TEST_SUITE_END();
     };
 
@@ -72,7 +72,8 @@ namespace pdfi
     m_nPages(0),
     m_nNextZOrder( 1 ),
     m_xStatusIndicator( xStat ),
-    m_bHaveTextOnDocLevel(false)
+    m_bHaveTextOnDocLevel(false),
+    m_pPageOptimizer()
 {
     FontAttributes aDefFont;
     aDefFont.familyName = "Helvetica";
@@ -93,6 +94,14 @@ void PDFIProcessor::enableToplevelText()
     m_bHaveTextOnDocLevel = true;
 }
 
+void PDFIProcessor::setTreeVisitorFactory( const TreeVisitorFactorySharedPtr& rVisitorFactory )
+{
+    if( rVisitorFactory )
+        m_pPageOptimizer = rVisitorFactory->createOptimizingVisitor(*this);
+    else
+        m_pPageOptimizer.reset();
+}
+
 void PDFIProcessor::setPageNum( sal_Int32 nPages )
 {
     m_nPages = nPages;
@@ -516,6 +525,12 @@ void PDFIProcessor::endPage()
         m_xStatusIndicator->end();
 }
 
+void PDFIProcessor::optimizePage( PageElement* pPage )
+{
+    if( pPage && m_pPageOptimizer )
+        pPage->visitedBy( *m_pPageOptimizer, std::list<Element*>::const_iterator() );
+}
+
 void PDFIProcessor::startPage( const geometry::RealSize2D& rSize )
 {
     // initial clip is to page bounds
@@ -523,6 +538,10 @@ void PDFIProcessor::startPage( const geometry::RealSize2D& rSize )
         basegfx::tools::createPolygonFromRect(
             basegfx::B2DRange( 0, 0, rSize.Width, rSize.Height )));
 
+    // links of a page are reported after its endPage, so the previous
+    // page is only complete once the next one starts
+    optimizePage( m_pCurPage );
+
     sal_Int32 nNextPageNr = m_pCurPage ? m_pCurPage->PageNumber+1 : 1;
     if( m_xStatusIndicator.is() )
     {
@@ -546,11 +565,19 @@ void PDFIProcessor::emit( XmlEmitter&               rEmitter,
     m_pDocument->emitStructure( 0 );
 #endif
 
-    ElementTreeVisitorSharedPtr optimizingVisitor(
-        rVisitorFactory.createOptimizingVisitor(*this));
     // FIXME: localization
     startIndicator( " " );
-    m_pDocument->visitedBy( *optimizingVisitor, std::list<Element*>::const_iterator());
+    if( m_pPageOptimizer )
+    {
+        // all but the last page have been optimized while parsing
+        optimizePage( m_pCurPage );
+    }
+    else
+    {
+        ElementTreeVisitorSharedPtr optimizingVisitor(
+            rVisitorFactory.createOptimizingVisitor(*this));
+        m_pDocument->visitedBy( *optimizingVisitor, std::list<Element*>::const_iterator());
+    }
 
 #if OSL_DEBUG_LEVEL > 1
     m_pDocument->emitStructure( 0 );
@@ -76,6 +76,17 @@ namespace pdfi
         /// TEMP - enable writer-like text:p on doc level
         void enableToplevelText();
 
+        /** Optimize each page as soon as it is complete
+
+            With a visitor factory set, every page is run through the
+            factory's optimizing visitor while the following page is
+            still being parsed. This merges the raw glyph elements early
+            and keeps the peak memory of large documents down; emit()
+            then only has to optimize the last page. The factory must be
+            the same one that is later passed to emit().
+         */
+        void setTreeVisitorFactory( const TreeVisitorFactorySharedPtr& rVisitorFactory );
+
         void emit( XmlEmitter&               rEmitter,
                    const TreeVisitorFactory& rVisitorFactory );
 
@@ -96,6 +107,7 @@ namespace pdfi
 
     private:
         void processGlyphLine();
+        void optimizePage( PageElement* pPage );
 
         // ContentSink interface implementation
 
@@ -200,6 +212,9 @@ namespace pdfi
                                            m_xStatusIndicator;
 
         bool                               m_bHaveTextOnDocLevel;
+
+        /// optimizing visitor for page-wise optimization, may be empty
+        ElementTreeVisitorSharedPtr        m_pPageOptimizer;
     };
     class CharGlyph
     {
@@ -124,6 +124,12 @@
 #include <boost/noncopyable.hpp>
 #include <memory>
 
+#if defined UNX && !defined MACOSX
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace ::com::sun::star;
 using namespace ::com::sun::star::uno;
 using namespace ::com::sun::star::ucb;
@@ -164,6 +170,99 @@ bool IsLockingUsed()
 
 #endif
 
+/** Whether rURL is a local file that may be replaced by renaming another file
+    over it.
+
+    A rename must not lose anything compared to writing into the file: so
+    the file has to be a regular one owned by us, and neither a symbolic link
+    nor a file with further hard links, which would silently be cut off.
+ */
+bool IsReplaceableByRename( const INetURLObject& rURL )
+{
+#if defined UNX && !defined MACOSX
+    if ( rURL.GetProtocol() != INetProtocol::File )
+        return false;
+    OUString aPath = rURL.getFSysPath( INetURLObject::FSYS_DETECT );
+    if ( aPath.isEmpty() )
+        return false;
+    struct stat aStat;
+    if ( lstat( OUStringToOString( aPath, osl_getThreadTextEncoding() ).getStr(), &aStat ) != 0 )
+        return false;
+    return S_ISREG( aStat.st_mode ) && aStat.st_nlink == 1
+        && aStat.st_uid == geteuid() && aStat.st_gid == getegid();
+#else
+    (void)rURL;
+    return false;
+#endif
+}
+
+/** Flushes the local file or folder rURL to the disk.
+ */
+bool SyncToDisk( const OUString& rURL )
+{
+#if defined UNX && !defined MACOSX
+    OUString aPath;
+    if ( osl::FileBase::getSystemPathFromFileURL( rURL, aPath ) != osl::FileBase::E_None )
+        return false;
+    int nFile = open( OUStringToOString( aPath, osl_getThreadTextEncoding() ).getStr(), O_RDONLY );
+    if ( nFile < 0 )
+        return false;
+    bool bResult = fsync( nFile ) == 0;
+    close( nFile );
+    return bResult;
+#else
+    (void)rURL;
+    return false;
+#endif
+}
+
+sal_uInt64 GetFileSize( const OUString& rURL )
+{
+    osl::DirectoryItem aItem;
+    osl::FileStatus aStatus( osl_FileStatus_Mask_FileSize );
+    if ( osl::DirectoryItem::get( rURL, aItem ) != osl::FileBase::E_None
+        || aItem.getFileStatus( aStatus ) != osl::FileBase::E_None )
+        return 0;
+    return aStatus.getFileSize();
+}
+
+/** Replaces the local file rDest by rSource in one rename, if both are in the
+    same folder, so that the document does not have to be copied.
+
+    The stored file is flushed before the rename and the folder after it, so
+    that after a crash the document is either the old or the new one.
+ */
+bool ReplaceByRename( const INetURLObject& rSource, const INetURLObject& rDest )
+{
+    INetURLObject aSourceFolder( rSource );
+    INetURLObject aDestFolder( rDest );
+    if ( !aSourceFolder.removeSegment() || !aDestFolder.removeSegment() || aSourceFolder != aDestFolder )
+        return false;
+    if ( !IsReplaceableByRename( rDest ) )
+        return false;
+
+    OUString aSourceURL = rSource.GetMainURL( INetURLObject::NO_DECODE );
+    OUString aDestURL = rDest.GetMainURL( INetURLObject::NO_DECODE );
+
+    // the temporary file is private, the document keeps its permissions
+    osl::DirectoryItem aItem;
+    osl::FileStatus aStatus( osl_FileStatus_Mask_Attributes );
+    if ( osl::DirectoryItem::get( aDestURL, aItem ) != osl::FileBase::E_None
+        || aItem.getFileStatus( aStatus ) != osl::FileBase::E_None
+        || osl::File::setAttributes( aSourceURL, aStatus.getAttributes() ) != osl::FileBase::E_None )
+        return false;
+
+    if ( !SyncToDisk( aSourceURL ) )
+        return false;
+
+    if ( osl::File::move( aSourceURL, aDestURL ) != osl::FileBase::E_None )
+        return false;
+
+    if ( !SyncToDisk( aDestFolder.GetMainURL( INetURLObject::NO_DECODE ) ) )
+        SAL_WARN( "sfx.doc", "could not flush the folder of " << aDestURL );
+    return true;
+}
+
 } // anonymous namespace
 
 class SfxMedium_Impl : private boost::noncopyable
@@ -1684,14 +1783,25 @@ void SfxMedium::TransactedTransferForFS_Impl( const INetURLObject& aSource,
         if( ::ucbhelper::Content::create( aSource.GetMainURL( INetURLObject::NO_DECODE ), xDummyEnv, comphelper::getProcessComponentContext(), aTempCont ) )
         {
             bool bTransactStarted = false;
+            bool bRenamed = false;
             const SfxBoolItem* pOverWrite = SfxItemSet::GetItem<SfxBoolItem>(GetItemSet(), SID_OVERWRITE, false);
                const SfxBoolItem* pRename = SfxItemSet::GetItem<SfxBoolItem>(GetItemSet(), SID_RENAME, false);
             bool bRename = pRename && pRename->GetValue();
             bool bOverWrite = pOverWrite ? pOverWrite->GetValue() : !bRename;
 
+            // a stream provided from outside has to stay connected to the document
+            const SfxUnoAnyItem* pStreamItem = SfxItemSet::GetItem<SfxUnoAnyItem>(GetItemSet(), SID_STREAM, false);
+
             try
             {
-                if( bOverWrite && ::utl::UCBContentHelper::IsDocument( aDest.GetMainURL( INetURLObject::NO_DECODE ) ) )
+                if( bOverWrite && !pStreamItem && ReplaceByRename( aSource, aDest ) )
+                {
+                    // the original stays untouched until the rename, so no backup is needed
+                    SAL_INFO( "sfx.doc", "stored " << aDest.GetMainURL( INetURLObject::NO_DECODE ) << " by renaming, 0 bytes copied" );
+                    bRenamed = true;
+                    bResult = true;
+                }
+                else if( bOverWrite && ::utl::UCBContentHelper::IsDocument( aDest.GetMainURL( INetURLObject::NO_DECODE ) ) )
                 {
                     if( pImp->m_aBackupURL.isEmpty() )
                         DoInternalBackup_Impl( aOriginalContent );
@@ -1703,6 +1813,8 @@ void SfxMedium::TransactedTransferForFS_Impl( const INetURLObject& aSource,
                         aOriginalContent.setPropertyValue( "Size", uno::makeAny( (sal_Int64)0 ) );
                         aOriginalContent.writeStream( aTempInput, bOverWrite );
                         bResult = true;
+                        SAL_INFO( "sfx.doc", "stored " << aDest.GetMainURL( INetURLObject::NO_DECODE ) << " by copying, "
+                                  << GetFileSize( aSource.GetMainURL( INetURLObject::NO_DECODE ) ) << " bytes copied" );
                     }
                     else
                     {
@@ -1714,6 +1826,8 @@ void SfxMedium::TransactedTransferForFS_Impl( const INetURLObject& aSource,
                     Reference< XInputStream > aTempInput = aTempCont.openStream();
                     aOriginalContent.writeStream( aTempInput, bOverWrite );
                     bResult = true;
+                    SAL_INFO( "sfx.doc", "stored " << aDest.GetMainURL( INetURLObject::NO_DECODE ) << " by copying, "
+                              << GetFileSize( aSource.GetMainURL( INetURLObject::NO_DECODE ) ) << " bytes copied" );
                 }
             }
             catch ( const css::ucb::CommandAbortedException& )
@@ -1744,10 +1858,44 @@ void SfxMedium::TransactedTransferForFS_Impl( const INetURLObject& aSource,
                {
                 if ( pImp->pTempFile )
                 {
-                    pImp->pTempFile->EnableKillingFile();
+                    // after a rename the temporary file is the document itself
+                    pImp->pTempFile->EnableKillingFile( !bRenamed );
                        delete pImp->pTempFile;
                        pImp->pTempFile = nullptr;
                 }
+
+                if ( bRenamed )
+                {
+                    // the medium is based on the renamed file now; the lock file
+                    // belongs to the URL and stays valid, but a system file lock is
+                    // still held on the replaced file and has to be taken again
+                    if ( osl::FileBase::getSystemPathFromFileURL( aDest.GetMainURL( INetURLObject::NO_DECODE ), pImp->m_aName )
+                         != osl::FileBase::E_None )
+                        pImp->m_aName.clear();
+
+                    if ( pImp->m_xLockingStream.is() )
+                    {
+                        try
+                        {
+                            uno::Reference< io::XInputStream > xInStream = pImp->m_xLockingStream->getInputStream();
+                            uno::Reference< io::XOutputStream > xOutStream = pImp->m_xLockingStream->getOutputStream();
+                            if ( xInStream.is() )
+                                xInStream->closeInput();
+                            if ( xOutStream.is() )
+                                xOutStream->closeOutput();
+                        }
+                        catch( const uno::Exception& )
+                        {}
+
+                        if ( pImp->xStream == pImp->m_xLockingStream )
+                        {
+                            pImp->xStream.clear();
+                            pImp->xInputStream.clear();
+                        }
+                        pImp->m_xLockingStream.clear();
+                        GetLockingStream_Impl();
+                    }
+                }
                }
             else if ( bTransactStarted )
             {
@@ -2431,8 +2579,10 @@ void SfxMedium::GetMedium_Impl()
                     }
                     else if ( GetURLObject().GetProtocol() == INetProtocol::File )
                     {
-                        // use the special locking approach only for file URLs
+                        // use the special locking approach only for file URLs,
+                        // the document is read in place without a copy
                         aMedium.addInputStreamOwnLock();
+                        SAL_INFO( "sfx.doc", "reading " << aFileName << " in place, 0 bytes copied" );
                     }
                     else
                     {
@@ -3424,6 +3574,8 @@ void SfxMedium::CreateTempFile( bool bReplace )
                     {
                         SetWritableForUserOnly( aTmpURL );
                         bTransferSuccess = true;
+                        SAL_INFO( "sfx.doc", "copied " << GetURLObject().GetMainURL( INetURLObject::NO_DECODE )
+                                  << " to a temporary file, " << GetFileSize( aTmpURL ) << " bytes copied" );
                     }
                 }
             }
@@ -3446,6 +3598,7 @@ void SfxMedium::CreateTempFile( bool bReplace )
             {
                 char        *pBuf = new char [8192];
                 sal_uInt32   nErr = ERRCODE_NONE;
+                sal_uInt64   nCopied = 0;
 
                 pImp->m_pInStream->Seek(0);
                 pImp->m_pOutStream->Seek(0);
@@ -3455,8 +3608,11 @@ void SfxMedium::CreateTempFile( bool bReplace )
                     sal_uInt32 nRead = pImp->m_pInStream->Read( pBuf, 8192 );
                     nErr = pImp->m_pInStream->GetError();
                     pImp->m_pOutStream->Write( pBuf, nRead );
+                    nCopied += nRead;
                 }
 
+                SAL_INFO( "sfx.doc", "copied " << GetURLObject().GetMainURL( INetURLObject::NO_DECODE )
+                          << " to a temporary file, " << nCopied << " bytes copied" );
                 bTransferSuccess = true;
                 delete[] pBuf;
                 CloseInStream();
@@ -3488,7 +3644,22 @@ void SfxMedium::CreateTempFileNoCopy()
     if ( pImp->pTempFile )
         delete pImp->pTempFile;
 
-    pImp->pTempFile = new ::utl::TempFile();
+    // when overwriting a local document, store next to it, so that
+    // the result can be renamed into place instead of being copied
+    pImp->pTempFile = nullptr;
+    INetURLObject aFolder( GetURLObject() );
+    if ( IsReplaceableByRename( aFolder ) && aFolder.removeSegment() )
+    {
+        OUString aFolderURL = aFolder.GetMainURL( INetURLObject::NO_DECODE );
+        pImp->pTempFile = new ::utl::TempFile( &aFolderURL );
+        if ( pImp->pTempFile->GetFileName().isEmpty() )
+        {
+            delete pImp->pTempFile;
+            pImp->pTempFile = nullptr;
+        }
+    }
+    if ( !pImp->pTempFile )
+        pImp->pTempFile = new ::utl::TempFile();
     pImp->pTempFile->EnableKillingFile();
     pImp->m_aName = pImp->pTempFile->GetFileName();
     if ( pImp->m_aName.isEmpty() )
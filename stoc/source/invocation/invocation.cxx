@@ -84,6 +84,30 @@ inline Reference<XIdlClass> TypeToIdlClass( const Type& rType, const Reference<
     return xRefl->forName( rType.getTypeName() );
 }
 
+// For these type classes equal classes mean equal types, so the value can be
+// passed as it is without asking the reflection
+inline bool isSimpleTypeClass( TypeClass eTypeClass )
+{
+    switch (eTypeClass)
+    {
+    case TypeClass_CHAR:
+    case TypeClass_BOOLEAN:
+    case TypeClass_BYTE:
+    case TypeClass_SHORT:
+    case TypeClass_UNSIGNED_SHORT:
+    case TypeClass_LONG:
+    case TypeClass_UNSIGNED_LONG:
+    case TypeClass_HYPER:
+    case TypeClass_UNSIGNED_HYPER:
+    case TypeClass_FLOAT:
+    case TypeClass_DOUBLE:
+    case TypeClass_STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
 
 class Invocation_Impl
     : public OWeakObject
@@ -665,7 +689,9 @@ Any Invocation_Impl::invoke( const OUString& FunctionName, const Sequence<Any>&
                 // is IN/INOUT parameter?
                 if (rFParam.aMode != ParamMode_OUT)
                 {
-                    if (rDestType->isAssignableFrom( TypeToIdlClass( pInParams[nPos].getValueType(), xCoreReflection ) ))
+                    const TypeClass eDestClass = rDestType->getTypeClass();
+                    if ((isSimpleTypeClass( eDestClass ) && eDestClass == pInParams[nPos].getValueTypeClass())
+                        || rDestType->isAssignableFrom( TypeToIdlClass( pInParams[nPos].getValueType(), xCoreReflection ) ))
                     {
                         pInvokeParams[nPos] = pInParams[nPos];
                     }
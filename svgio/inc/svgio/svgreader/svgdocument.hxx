@@ -23,6 +23,7 @@
 #include <boost/noncopyable.hpp>
 #include <svgio/svgreader/svgnode.hxx>
 #include <unordered_map>
+#include <map>
 
 namespace svgio
 {
@@ -49,6 +50,11 @@ namespace svgio
             typedef std::pair< const OUString, const SvgStyleAttributes* > IdStyleTokenValueType;
             IdStyleTokenMapper      maIdStyleTokenMapperList;
 
+            /// decomposed content referenced by <use> elements, see SvgUseNode::decomposeSvgNode
+            typedef std::pair< const SvgNode*, const SvgNode* > UseContentKey;
+            typedef std::map< UseContentKey, drawinglayer::primitive2d::Primitive2DContainer > UseContentMapper;
+            UseContentMapper        maUseContentMapperList;
+
         public:
             SvgDocument(const OUString& rAbsolutePath);
             ~SvgDocument();
@@ -70,6 +76,10 @@ namespace svgio
             bool hasGlobalCssStyleAttributes() const { return !maIdStyleTokenMapperList.empty(); }
             const SvgStyleAttributes* findGlobalCssStyleAttributes(const OUString& rStr) const;
 
+            /// add/find the decomposition of rTarget as seen from the inherited context rContext
+            void addUseContent(const SvgNode& rTarget, const SvgNode& rContext, const drawinglayer::primitive2d::Primitive2DContainer& rContent);
+            const drawinglayer::primitive2d::Primitive2DContainer* findUseContent(const SvgNode& rTarget, const SvgNode& rContext) const;
+
             /// data read access
             const SvgNodeVector& getSvgNodeVector() const { return maNodes; }
             const OUString& getAbsolutePath() const { return maAbsolutePath; }
@@ -180,6 +180,9 @@ namespace svgio
 
             /// alternative parent
             void setAlternativeParent(const SvgNode* pAlternativeParent = nullptr) { mpAlternativeParent = pAlternativeParent; }
+
+            /// tell if this node or one of its parents is currently decomposed using an alternative parent
+            bool isInAlternativeHierarchy() const;
         };
     } // end of namespace svgreader
 } // end of namespace svgio
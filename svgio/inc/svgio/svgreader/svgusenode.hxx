@@ -44,6 +44,11 @@ namespace svgio
             // on demand
             OUString               maXLink;
 
+            /// bitfield
+            /// set when an attribute other than geometry, link or selector was given;
+            /// the referenced content may then depend on this node and is not shared
+            bool                        mbStyleAttributeSet : 1;
+
         public:
             SvgUseNode(
                 SvgDocument& rDocument,
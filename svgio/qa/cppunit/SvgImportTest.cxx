@@ -22,8 +22,10 @@
 #include <com/sun/star/graphic/XPrimitive2D.hpp>
 
 #include <drawinglayer/primitive2d/baseprimitive2d.hxx>
+#include <drawinglayer/primitive2d/transformprimitive2d.hxx>
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -33,6 +35,7 @@ using namespace css::io;
 using namespace css::graphic;
 using drawinglayer::primitive2d::Primitive2DSequence;
 using drawinglayer::primitive2d::Primitive2DContainer;
+using drawinglayer::primitive2d::TransformPrimitive2D;
 
 class Test : public test::BootstrapFixture, public XmlTestTools
 {
@@ -53,6 +56,7 @@ class Test : public test::BootstrapFixture, public XmlTestTools
     void testRGBColor();
     void testRGBAColor();
     void testTdf97936();
+    void testUseSharedContent();
 
     Primitive2DSequence parseSvg(const char* aSource);
 
@@ -76,6 +80,7 @@ public:
     CPPUNIT_TEST(testRGBColor);
     CPPUNIT_TEST(testRGBAColor);
     CPPUNIT_TEST(testTdf97936);
+    CPPUNIT_TEST(testUseSharedContent);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -378,6 +383,49 @@ void Test::testTdf97936()
     assertXPath(pDocument, "/primitive2D/transform/polypolygoncolor[2]", "height", "50");
     assertXPath(pDocument, "/primitive2D/transform/polypolygoncolor[2]", "width", "50");
 }
+
+void Test::testUseSharedContent()
+{
+    // <use> siblings without own styles share the decomposed content, those
+    // with style attributes and those with another parent must not
+    Primitive2DSequence aSequenceUse = parseSvg("/svgio/qa/cppunit/data/UseSharedContent.svg");
+    CPPUNIT_ASSERT_EQUAL(1, (int)aSequenceUse.getLength());
+
+    Primitive2dXmlDump dumper;
+    xmlDocPtr pDocument = dumper.dumpAndParse(comphelper::sequenceToContainer<Primitive2DContainer>(aSequenceUse));
+
+    CPPUNIT_ASSERT (pDocument);
+
+    assertXPath(pDocument, "/primitive2D/transform/transform", 5);
+    assertXPath(pDocument, "/primitive2D/transform/transform[1]/polypolygoncolor", "color", "#00cc00");
+    assertXPath(pDocument, "/primitive2D/transform/transform[1]/polypolygoncolor", "width", "50");
+    assertXPath(pDocument, "/primitive2D/transform/transform[2]/polypolygoncolor", "color", "#00cc00");
+    assertXPath(pDocument, "/primitive2D/transform/transform[2]/polypolygoncolor", "width", "50");
+    assertXPath(pDocument, "/primitive2D/transform/transform[3]/polypolygoncolor", "color", "#ff0000");
+    assertXPath(pDocument, "/primitive2D/transform/transform[4]/polypolygoncolor", "color", "#0000ff");
+    assertXPath(pDocument, "/primitive2D/transform/transform[5]/polypolygoncolor", "color", "#000000");
+
+    // the content of each <use> below the transformation for its position
+    const TransformPrimitive2D* pRoot = dynamic_cast<const TransformPrimitive2D*>(aSequenceUse[0].get());
+    CPPUNIT_ASSERT(pRoot);
+    const Primitive2DContainer& rUses = pRoot->getChildren();
+    CPPUNIT_ASSERT_EQUAL(size_t(5), rUses.size());
+    std::vector<const Primitive2DContainer*> aContents;
+    for (const auto& rUse : rUses)
+    {
+        const TransformPrimitive2D* pUse = dynamic_cast<const TransformPrimitive2D*>(rUse.get());
+        CPPUNIT_ASSERT(pUse);
+        CPPUNIT_ASSERT_EQUAL(size_t(1), pUse->getChildren().size());
+        aContents.push_back(&pUse->getChildren());
+    }
+
+    // the first two are the very same primitives, all the others are not
+    CPPUNIT_ASSERT_EQUAL((*aContents[0])[0].get(), (*aContents[1])[0].get());
+    for (size_t i = 2; i < aContents.size(); ++i)
+        for (size_t j = 0; j < i; ++j)
+            CPPUNIT_ASSERT((*aContents[i])[0].get() != (*aContents[j])[0].get());
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(Test);
 
 }
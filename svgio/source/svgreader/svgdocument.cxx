@@ -27,7 +27,8 @@ namespace svgio
         :   maNodes(),
             maAbsolutePath(rAbsolutePath),
             maIdTokenMapperList(),
-            maIdStyleTokenMapperList()
+            maIdStyleTokenMapperList(),
+            maUseContentMapperList()
         {
         }
 
@@ -63,6 +64,23 @@ namespace svgio
             }
         }
 
+        void SvgDocument::addUseContent(const SvgNode& rTarget, const SvgNode& rContext, const drawinglayer::primitive2d::Primitive2DContainer& rContent)
+        {
+            maUseContentMapperList[UseContentKey(&rTarget, &rContext)] = rContent;
+        }
+
+        const drawinglayer::primitive2d::Primitive2DContainer* SvgDocument::findUseContent(const SvgNode& rTarget, const SvgNode& rContext) const
+        {
+            const UseContentMapper::const_iterator aResult(maUseContentMapperList.find(UseContentKey(&rTarget, &rContext)));
+
+            if(aResult == maUseContentMapperList.end())
+            {
+                return nullptr;
+            }
+
+            return &aResult->second;
+        }
+
         const SvgNode* SvgDocument::findSvgNodeById(const OUString& rStr) const
         {
             const IdTokenMapper::const_iterator aResult(maIdTokenMapperList.find(rStr));
@@ -435,6 +435,19 @@ namespace svgio
             return Display_inline;
         }
 
+        bool SvgNode::isInAlternativeHierarchy() const
+        {
+            for(const SvgNode* pCandidate = this; pCandidate; pCandidate = pCandidate->getParent())
+            {
+                if(pCandidate->mpAlternativeParent)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         void SvgNode::parseAttribute(const OUString& /*rTokenName*/, SVGToken aSVGToken, const OUString& aContent)
         {
             switch(aSVGToken)
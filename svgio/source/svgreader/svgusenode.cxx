@@ -35,7 +35,8 @@ namespace svgio
             maY(),
             maWidth(),
             maHeight(),
-            maXLink()
+            maXLink(),
+            mbStyleAttributeSet(false)
         {
         }
 
@@ -131,8 +132,16 @@ namespace svgio
                     }
                     break;
                 }
+                case SVGTokenId:
+                case SVGTokenClass:
+                {
+                    // selectors are covered by the CssStyle check in decomposeSvgNode
+                    break;
+                }
                 default:
                 {
+                    // presentation attributes and anything not known to be neutral
+                    mbStyleAttributeSet = true;
                     break;
                 }
             }
@@ -148,12 +157,40 @@ namespace svgio
                 // decompose children
                 drawinglayer::primitive2d::Primitive2DContainer aNewTarget;
 
-                // todo: in case mpXLink is a SVGTokenSvg or SVGTokenSymbol the
-                // SVG docs want the getWidth() and getHeight() from this node
-                // to be valid for the subtree.
-                const_cast< SvgNode* >(mpXLink)->setAlternativeParent(this);
-                mpXLink->decomposeSvgNode(aNewTarget, true);
-                const_cast< SvgNode* >(mpXLink)->setAlternativeParent();
+                // When this node adds nothing to the inherited style, the referenced
+                // content looks the same for all <use> siblings sharing a parent. Maps
+                // and diagrams often place thousands of instances of one symbol, so
+                // decompose it once per parent and only add the transformation here.
+                // This is not possible inside another alternative hierarchy, there the
+                // inherited context depends on the outer <use> as well.
+                const SvgNode* pContext = getParent();
+                const bool bShareContent(
+                    pContext
+                    && !mbStyleAttributeSet
+                    && getSvgStyleAttributes() == &maSvgStyleAttributes
+                    && !isInAlternativeHierarchy());
+                const drawinglayer::primitive2d::Primitive2DContainer* pShared = bShareContent
+                    ? getDocument().findUseContent(*mpXLink, *pContext)
+                    : nullptr;
+
+                if(pShared)
+                {
+                    aNewTarget = *pShared;
+                }
+                else
+                {
+                    // todo: in case mpXLink is a SVGTokenSvg or SVGTokenSymbol the
+                    // SVG docs want the getWidth() and getHeight() from this node
+                    // to be valid for the subtree.
+                    const_cast< SvgNode* >(mpXLink)->setAlternativeParent(this);
+                    mpXLink->decomposeSvgNode(aNewTarget, true);
+                    const_cast< SvgNode* >(mpXLink)->setAlternativeParent();
+
+                    if(bShareContent)
+                    {
+                        const_cast< SvgDocument& >(getDocument()).addUseContent(*mpXLink, *pContext, aNewTarget);
+                    }
+                }
 
                 if(!aNewTarget.empty())
                 {
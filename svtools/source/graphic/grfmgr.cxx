@@ -58,13 +58,14 @@ struct GrfSimpleCacheObj
 };
 
 // unique increasing ID for being able to detect the GraphicObject with the
-// oldest last data changes
+// oldest last data changes resp. the least recently used one
 static sal_uLong aIncrementingTimeOfLastDataChange = 1;
 
 void GraphicObject::ImplAfterDataChange()
 {
     // set unique timestamp ID of last data change
     mnDataChangeTimeStamp = aIncrementingTimeOfLastDataChange++;
+    mnLastUseTimeStamp = mnDataChangeTimeStamp;
 
     // check memory footprint of all GraphicObjects managed and evtl. take action
     if (mpMgr)
@@ -149,6 +150,7 @@ void GraphicObject::ImplConstruct()
 
     // Init with a unique, increasing ID
     mnDataChangeTimeStamp = aIncrementingTimeOfLastDataChange++;
+    mnLastUseTimeStamp = mnDataChangeTimeStamp;
 }
 
 void GraphicObject::ImplAssignGraphicData()
@@ -524,6 +526,8 @@ bool GraphicObject::Draw( OutputDevice* pOut, const Point& rPt, const Size& rSz,
     // #i29534# Provide output rects for PDF writer
     Rectangle           aCropRect;
 
+    mnLastUseTimeStamp = aIncrementingTimeOfLastDataChange++;
+
     if( !( GraphicManagerDrawFlags::USE_DRAWMODE_SETTINGS & nFlags ) )
         pOut->SetDrawMode( nOldDrawMode & ~DrawModeFlags( DrawModeFlags::SettingsLine | DrawModeFlags::SettingsFill | DrawModeFlags::SettingsText | DrawModeFlags::SettingsGradient ) );
 
@@ -682,6 +686,7 @@ const Graphic& GraphicObject::GetGraphic() const
     //the cache timeout to start from now and not remain at the
     //time of creation
     pThis->restartSwapOutTimer();
+    pThis->mnLastUseTimeStamp = aIncrementingTimeOfLastDataChange++;
 
     return maGraphic;
 }
@@ -182,11 +182,11 @@ OString GraphicManager::ImplGetUniqueID( const GraphicObject& rObj ) const
 
 namespace
 {
-    struct simpleSortByDataChangeTimeStamp
+    struct simpleSortByLastUseTimeStamp
     {
         bool operator() (GraphicObject* p1, GraphicObject* p2) const
         {
-            return p1->GetDataChangeTimeStamp() < p2->GetDataChangeTimeStamp();
+            return p1->GetLastUseTimeStamp() < p2->GetLastUseTimeStamp();
         }
     };
 } // end of anonymous namespace
@@ -201,9 +201,9 @@ void GraphicManager::ImplCheckSizeOfSwappedInGraphics(const GraphicObject* pGrap
     {
         // Copy the object list for now, because maObjList can change in the meantime unexpectedly.
         std::vector< GraphicObject* > aCandidates(maObjList.begin(), maObjList.end());
-        // if we use more currently, sort by last DataChangeTimeStamp
-        // sort by DataChangeTimeStamp so that the oldest get removed first
-        ::std::sort(aCandidates.begin(), aCandidates.end(), simpleSortByDataChangeTimeStamp());
+        // if we use more currently, sort by LastUseTimeStamp so that the
+        // least recently used get removed first
+        ::std::sort(aCandidates.begin(), aCandidates.end(), simpleSortByLastUseTimeStamp());
 
         for(sal_uInt32 a(0); mnUsedSize >= nMaxCacheSize && a < aCandidates.size(); a++)
         {
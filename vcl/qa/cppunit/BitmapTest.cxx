@@ -32,11 +32,13 @@ class BitmapTest : public CppUnit::TestFixture
 {
     void testConvert();
     void testScale();
+    void testScaleConvolution();
     void testCRC();
 
     CPPUNIT_TEST_SUITE(BitmapTest);
     CPPUNIT_TEST(testConvert);
     CPPUNIT_TEST(testScale);
+    CPPUNIT_TEST(testScaleConvolution);
     CPPUNIT_TEST(testCRC);
     CPPUNIT_TEST_SUITE_END();
 };
@@ -143,6 +145,42 @@ void BitmapTest::testScale()
     }
 }
 
+void BitmapTest::testScaleConvolution()
+{
+    // large enough for the convolution passes to be split over threads;
+    // red ramps down the rows and green along the columns, so a strip that
+    // got skipped, filtered twice or written to the wrong rows shows up
+    const long nWidth(1024), nHeight(768), nNewWidth(600), nNewHeight(450);
+    Bitmap aBitmap(Size(nWidth, nHeight), 24);
+    {
+        Bitmap::ScopedWriteAccess aWriteAccess(aBitmap);
+        for (long y = 0; y < nHeight; ++y)
+            for (long x = 0; x < nWidth; ++x)
+                aWriteAccess->SetPixel(y, x, BitmapColor(sal_uInt8(y / 3), sal_uInt8(x / 4), 128));
+    }
+
+    CPPUNIT_ASSERT(aBitmap.Scale(Size(nNewWidth, nNewHeight), BmpScaleFlag::Lanczos));
+    CPPUNIT_ASSERT_EQUAL(nNewWidth, aBitmap.GetSizePixel().Width());
+    CPPUNIT_ASSERT_EQUAL(nNewHeight, aBitmap.GetSizePixel().Height());
+
+    // the filter reproduces a linear ramp away from the clamped edges, up to
+    // the steps of the source ramp and the truncation after each pass
+    const long nBorder(8);
+    Bitmap::ScopedReadAccess pReadAccess(aBitmap);
+    for (long y = nBorder; y < nNewHeight - nBorder; ++y)
+    {
+        const double fExpectedRed(y * double(nHeight) / nNewHeight / 3.0);
+        for (long x = nBorder; x < nNewWidth - nBorder; ++x)
+        {
+            const double fExpectedGreen(x * double(nWidth) / nNewWidth / 4.0);
+            const BitmapColor aColor(pReadAccess->GetPixel(y, x));
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(fExpectedRed, double(aColor.GetRed()), 3.0);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(fExpectedGreen, double(aColor.GetGreen()), 3.0);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(128.0, double(aColor.GetBlue()), 2.0);
+        }
+    }
+}
+
 typedef std::unordered_map<sal_uInt64, const char *> CRCHash;
 
 void checkAndInsert(CRCHash &rHash, sal_uInt64 nCRC, const char *pLocation)
@@ -13,6 +13,8 @@
 #include <osl/file.hxx>
 #include <osl/process.h>
 
+#include <com/sun/star/awt/Size.hpp>
+
 #include <vcl/graphicfilter.hxx>
 
 using namespace ::com::sun::star;
@@ -43,11 +45,13 @@ public:
 
     void testScaling();
     void testExportImport();
+    void testJpegPreviewSizeHint();
 
     CPPUNIT_TEST_SUITE(VclFiltersTest);
     CPPUNIT_TEST(testCVEs);
     CPPUNIT_TEST(testScaling);
     CPPUNIT_TEST(testExportImport);
+    CPPUNIT_TEST(testJpegPreviewSizeHint);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -119,6 +123,37 @@ void VclFiltersTest::testExportImport()
     checkExportImport("bmp");
 }
 
+void VclFiltersTest::testJpegPreviewSizeHint()
+{
+    Bitmap aBitmap( Size( 800, 600 ), 24 );
+    aBitmap.Erase(COL_WHITE);
+
+    SvMemoryStream aStream;
+    sal_uInt16 aFilterType = mGraphicFilter.GetExportFormatNumberForShortName("jpg");
+    mGraphicFilter.ExportGraphic( aBitmap, OUString(), aStream, aFilterType );
+    CPPUNIT_ASSERT(aStream.Tell() > 0);
+
+    // the DCT scaling may only reduce the image as far as the hint allows
+    const Size aHints[] = { Size( 100, 75 ), Size( 150, 100 ), Size( 300, 300 ), Size( 500, 100 ) };
+    for (const Size& rHint : aHints)
+    {
+        aStream.Seek( STREAM_SEEK_TO_BEGIN );
+
+        css::uno::Sequence< css::beans::PropertyValue > aFilterData( 1 );
+        aFilterData[ 0 ].Name = "PreviewSizeHint";
+        aFilterData[ 0 ].Value <<= css::awt::Size( rHint.Width(), rHint.Height() );
+
+        Graphic aLoadedGraphic;
+        CPPUNIT_ASSERT_EQUAL( sal_uInt16(0), mGraphicFilter.ImportGraphic( aLoadedGraphic, OUString(), aStream,
+            GRFILTER_FORMAT_DONTKNOW, nullptr, GraphicFilterImportFlags::NONE, &aFilterData ) );
+
+        Size aSize = aLoadedGraphic.GetBitmapEx().GetSizePixel();
+        CPPUNIT_ASSERT(aSize.Width() >= rHint.Width());
+        CPPUNIT_ASSERT(aSize.Height() >= rHint.Height());
+        CPPUNIT_ASSERT(aSize.Width() <= 800);
+    }
+}
+
 void VclFiltersTest::testCVEs()
 {
 #ifndef DISABLE_CVE_TESTS
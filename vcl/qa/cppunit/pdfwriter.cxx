@@ -0,0 +1,107 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <test/bootstrapfixture.hxx>
+
+#include <com/sun/star/beans/XMaterialHolder.hpp>
+
+#include <rtl/strbuf.hxx>
+#include <tools/stream.hxx>
+#include <unotools/tempfile.hxx>
+#include <vcl/bitmapaccess.hxx>
+#include <vcl/bitmapex.hxx>
+#include <vcl/gdimtf.hxx>
+#include <vcl/metaact.hxx>
+#include <vcl/pdfwriter.hxx>
+
+using namespace css;
+
+class VclPdfWriterTest : public test::BootstrapFixture
+{
+    sal_Int32 countImageXObjects(bool bOnlyLossless);
+
+public:
+    VclPdfWriterTest() : BootstrapFixture(true, false) {}
+
+    void testRepeatedImageLossless();
+    void testRepeatedImage();
+
+    CPPUNIT_TEST_SUITE(VclPdfWriterTest);
+    CPPUNIT_TEST(testRepeatedImageLossless);
+    CPPUNIT_TEST(testRepeatedImage);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+sal_Int32 VclPdfWriterTest::countImageXObjects(bool bOnlyLossless)
+{
+    Bitmap aBitmap(Size(64, 64), 24);
+    {
+        Bitmap::ScopedWriteAccess pAccess(aBitmap);
+        for (long y = 0; y < pAccess->Height(); ++y)
+            for (long x = 0; x < pAccess->Width(); ++x)
+                pAccess->SetPixel(y, x, BitmapColor(y * 4, x * 4, 128));
+    }
+    const BitmapEx aBitmapEx(aBitmap);
+
+    // the same image, drawn twice on each page at different positions
+    GDIMetaFile aMtf;
+    aMtf.SetPrefMapMode(MapMode(MAP_100TH_MM));
+    aMtf.SetPrefSize(Size(10000, 10000));
+    aMtf.AddAction(new MetaBmpExScaleAction(Point(0, 0), Size(2000, 2000), aBitmapEx));
+    aMtf.AddAction(new MetaBmpExScaleAction(Point(5000, 5000), Size(2000, 2000), aBitmapEx));
+
+    utl::TempFile aTempFile;
+    aTempFile.EnableKillingFile();
+
+    vcl::PDFWriter::PDFWriterContext aContext;
+    aContext.URL = aTempFile.GetURL();
+    {
+        vcl::PDFWriter aWriter(aContext, uno::Reference<beans::XMaterialHolder>());
+        vcl::PDFWriter::PlayMetafileContext aPlayContext;
+        aPlayContext.m_bOnlyLosslessCompression = bOnlyLossless;
+        for (int nPage = 0; nPage < 2; ++nPage)
+        {
+            aWriter.NewPage();
+            aWriter.SetMapMode(aMtf.GetPrefMapMode());
+            aWriter.PlayMetafile(aMtf, aPlayContext);
+        }
+        CPPUNIT_ASSERT(aWriter.Emit());
+    }
+
+    // object dictionaries are not compressed, so each image XObject
+    // shows up once in the file
+    SvFileStream aStream(aTempFile.GetURL(), StreamMode::READ);
+    OStringBuffer aBuffer;
+    OString aLine;
+    while (aStream.ReadLine(aLine))
+        aBuffer.append(aLine).append('\n');
+    const OString aContent(aBuffer.makeStringAndClear());
+
+    sal_Int32 nCount = 0;
+    for (sal_Int32 nPos = aContent.indexOf("/Subtype/Image"); nPos != -1;
+         nPos = aContent.indexOf("/Subtype/Image", nPos + 1))
+        ++nCount;
+    return nCount;
+}
+
+void VclPdfWriterTest::testRepeatedImageLossless()
+{
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), countImageXObjects(true));
+}
+
+void VclPdfWriterTest::testRepeatedImage()
+{
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(1), countImageXObjects(false));
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(VclPdfWriterTest);
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
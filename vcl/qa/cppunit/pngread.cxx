@@ -0,0 +1,157 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+#include <cppunit/plugin/TestPlugIn.h>
+
+#include <vector>
+
+#include <rtl/crc.h>
+#include <tools/stream.hxx>
+#include <tools/zcodec.hxx>
+#include <vcl/bitmapaccess.hxx>
+#include <vcl/bitmapex.hxx>
+#include <vcl/pngread.hxx>
+
+namespace
+{
+
+class PngReadTest : public CppUnit::TestFixture
+{
+    void testPreviewGrey();
+    void testPreviewRGB();
+    void testPreviewRGBA();
+
+    CPPUNIT_TEST_SUITE(PngReadTest);
+    CPPUNIT_TEST(testPreviewGrey);
+    CPPUNIT_TEST(testPreviewRGB);
+    CPPUNIT_TEST(testPreviewRGBA);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+void writeChunk(SvStream& rStream, const char* pType, const std::vector<sal_uInt8>& rData)
+{
+    std::vector<sal_uInt8> aChunk(pType, pType + 4);
+    aChunk.insert(aChunk.end(), rData.begin(), rData.end());
+    rStream.WriteUInt32(rData.size());
+    rStream.Write(aChunk.data(), aChunk.size());
+    rStream.WriteUInt32(rtl_crc32(0, aChunk.data(), aChunk.size()));
+}
+
+// Write a non-interlaced 8 bit per sample PNG of the given color type
+// (0 = grey, 2 = RGB, 6 = RGBA) with a pattern that differs in every pixel.
+void writePng(SvStream& rStream, sal_uInt8 nColorType, long nWidth, long nHeight)
+{
+    const long nChannels = nColorType == 0 ? 1 : (nColorType == 2 ? 3 : 4);
+
+    rStream.SetEndian(SvStreamEndian::BIG);
+    const sal_uInt8 aSignature[] = { 0x89, 'P', 'N', 'G', 0x0d, 0x0a, 0x1a, 0x0a };
+    rStream.Write(aSignature, sizeof(aSignature));
+
+    SvMemoryStream aHeader;
+    aHeader.SetEndian(SvStreamEndian::BIG);
+    aHeader.WriteUInt32(nWidth).WriteUInt32(nHeight);
+    aHeader.WriteUChar(8).WriteUChar(nColorType).WriteUChar(0).WriteUChar(0).WriteUChar(0);
+    const sal_uInt8* pHeader = static_cast<const sal_uInt8*>(aHeader.GetData());
+    writeChunk(rStream, "IHDR", std::vector<sal_uInt8>(pHeader, pHeader + aHeader.Tell()));
+
+    std::vector<sal_uInt8> aRaw;
+    for (long y = 0; y < nHeight; ++y)
+    {
+        aRaw.push_back(0); // filter type None
+        for (long x = 0; x < nWidth; ++x)
+        {
+            aRaw.push_back(static_cast<sal_uInt8>(x * 255 / (nWidth - 1)));
+            if (nChannels > 1)
+            {
+                aRaw.push_back(static_cast<sal_uInt8>(y * 255 / (nHeight - 1)));
+                aRaw.push_back(static_cast<sal_uInt8>((x + y) * 7));
+            }
+            if (nChannels > 3)
+                aRaw.push_back(static_cast<sal_uInt8>(255 - (x * y) % 256));
+        }
+    }
+    SvMemoryStream aCompressed;
+    ZCodec aCodec;
+    aCodec.BeginCompression();
+    aCodec.Write(aCompressed, aRaw.data(), aRaw.size());
+    aCodec.EndCompression();
+    const sal_uInt8* pCompressed = static_cast<const sal_uInt8*>(aCompressed.GetData());
+    writeChunk(rStream, "IDAT", std::vector<sal_uInt8>(pCompressed, pCompressed + aCompressed.Tell()));
+
+    writeChunk(rStream, "IEND", std::vector<sal_uInt8>());
+    rStream.Seek(0);
+}
+
+// The preview picks every (1 << shift)th pixel of every (1 << shift)th
+// row, so it must equal the full decode sampled at those positions.
+void checkPreview(sal_uInt8 nColorType)
+{
+    const long nWidth = 250;
+    const long nHeight = 250;
+
+    SvMemoryStream aFullStream;
+    writePng(aFullStream, nColorType, nWidth, nHeight);
+    vcl::PNGReader aFullReader(aFullStream);
+    const BitmapEx aFull = aFullReader.Read();
+    CPPUNIT_ASSERT_EQUAL(Size(nWidth, nHeight), aFull.GetSizePixel());
+
+    SvMemoryStream aPreviewStream;
+    writePng(aPreviewStream, nColorType, nWidth, nHeight);
+    vcl::PNGReader aPreviewReader(aPreviewStream);
+    const BitmapEx aPreview = aPreviewReader.Read(Size(60, 60));
+    // 250 >> 2 is the last size still above the hint; rounded up
+    const long nShift = 2;
+    CPPUNIT_ASSERT_EQUAL(Size(63, 63), aPreview.GetSizePixel());
+    CPPUNIT_ASSERT_EQUAL(aFull.IsTransparent(), aPreview.IsTransparent());
+
+    Bitmap aFullBitmap(aFull.GetBitmap());
+    Bitmap aPreviewBitmap(aPreview.GetBitmap());
+    Bitmap::ScopedReadAccess pFullAccess(aFullBitmap);
+    Bitmap::ScopedReadAccess pPreviewAccess(aPreviewBitmap);
+    for (long y = 0; y < pPreviewAccess->Height(); ++y)
+    {
+        for (long x = 0; x < pPreviewAccess->Width(); ++x)
+        {
+            const BitmapColor aExpected = pFullAccess->GetColor(y << nShift, x << nShift);
+            const BitmapColor aActual = pPreviewAccess->GetColor(y, x);
+            CPPUNIT_ASSERT_EQUAL(int(aExpected.GetRed()), int(aActual.GetRed()));
+            CPPUNIT_ASSERT_EQUAL(int(aExpected.GetGreen()), int(aActual.GetGreen()));
+            CPPUNIT_ASSERT_EQUAL(int(aExpected.GetBlue()), int(aActual.GetBlue()));
+            if (aFull.IsTransparent())
+                CPPUNIT_ASSERT_EQUAL(int(aFull.GetTransparency(x << nShift, y << nShift)),
+                                     int(aPreview.GetTransparency(x, y)));
+        }
+    }
+}
+
+void PngReadTest::testPreviewGrey()
+{
+    checkPreview(0);
+}
+
+void PngReadTest::testPreviewRGB()
+{
+    checkPreview(2);
+}
+
+void PngReadTest::testPreviewRGBA()
+{
+    checkPreview(6);
+}
+
+} // namespace
+
+CPPUNIT_TEST_SUITE_REGISTRATION(PngReadTest);
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -21,9 +21,13 @@
 #include "ResampleKernel.hxx"
 
 #include <vcl/bitmapaccess.hxx>
+#include <osl/conditn.hxx>
 #include <osl/diagnose.h>
+#include <osl/interlck.h>
+#include <comphelper/threadpool.hxx>
 
 #include <algorithm>
+#include <cstdlib>
 #include <memory>
 
 namespace vcl
@@ -84,6 +88,190 @@ void ImplCalculateContributions(
     }
 }
 
+// number of destination rows a thread task filters at once
+#define CONVOLUTION_THREAD_STRIP 32
+
+struct ConvolutionContext
+{
+    BitmapReadAccess*   mpSrc;
+    BitmapWriteAccess*  mpDest;
+    const double*       mpWeights;
+    const long*         mpPixels;
+    const long*         mpCount;
+    long                mnNumberOfContributions;
+    long                mnDestWidth;
+
+    ConvolutionContext(BitmapReadAccess* pSrc, BitmapWriteAccess* pDest,
+                       const double* pWeights, const long* pPixels, const long* pCount,
+                       long nNumberOfContributions)
+        : mpSrc(pSrc)
+        , mpDest(pDest)
+        , mpWeights(pWeights)
+        , mpPixels(pPixels)
+        , mpCount(pCount)
+        , mnNumberOfContributions(nNumberOfContributions)
+        , mnDestWidth(pDest->Width())
+    {
+    }
+};
+
+typedef void (*ConvolutionRangeFn)(const ConvolutionContext& rCtx, long nStartY, long nEndY);
+
+inline BitmapColor ImplGetSourceColor(const BitmapReadAccess& rAcc, bool bPalette, long nY, long nX)
+{
+    return bPalette ? rAcc.GetPaletteColor(rAcc.GetPixelIndex(nY, nX)) : rAcc.GetPixel(nY, nX);
+}
+
+inline void ImplSetResultColor(BitmapWriteAccess& rAcc, long nY, long nX, double fSum,
+                               double fRed, double fGreen, double fBlue)
+{
+    const BitmapColor aResultColor(
+        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(fRed / fSum), 0, 255)),
+        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(fGreen / fSum), 0, 255)),
+        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(fBlue / fSum), 0, 255)));
+
+    if(rAcc.HasPalette())
+    {
+        rAcc.SetPixelIndex(nY, nX, static_cast< sal_uInt8 >(rAcc.GetBestPaletteIndex(aResultColor)));
+    }
+    else
+    {
+        rAcc.SetPixel(nY, nX, aResultColor);
+    }
+}
+
+// filter the destination rows [nStartY, nEndY] horizontally
+void ImplConvolveRowsHor(const ConvolutionContext& rCtx, long nStartY, long nEndY)
+{
+    const bool bPalette(rCtx.mpSrc->HasPalette());
+
+    for(long y(nStartY); y <= nEndY; y++)
+    {
+        for(long x(0); x < rCtx.mnDestWidth; x++)
+        {
+            const long aBaseIndex(x * rCtx.mnNumberOfContributions);
+            double aSum(0.0);
+            double aValueRed(0.0);
+            double aValueGreen(0.0);
+            double aValueBlue(0.0);
+
+            for(long j(0); j < rCtx.mpCount[x]; j++)
+            {
+                const long aIndex(aBaseIndex + j);
+                const double aWeight(rCtx.mpWeights[aIndex]);
+                const BitmapColor aColor(ImplGetSourceColor(*rCtx.mpSrc, bPalette, y, rCtx.mpPixels[aIndex]));
+
+                aSum += aWeight;
+                aValueRed += aWeight * aColor.GetRed();
+                aValueGreen += aWeight * aColor.GetGreen();
+                aValueBlue += aWeight * aColor.GetBlue();
+            }
+
+            ImplSetResultColor(*rCtx.mpDest, y, x, aSum, aValueRed, aValueGreen, aValueBlue);
+        }
+    }
+}
+
+// filter the destination rows [nStartY, nEndY] vertically; walking the
+// destination row by row keeps the source accesses scanline local
+void ImplConvolveRowsVer(const ConvolutionContext& rCtx, long nStartY, long nEndY)
+{
+    const bool bPalette(rCtx.mpSrc->HasPalette());
+
+    for(long y(nStartY); y <= nEndY; y++)
+    {
+        const long aBaseIndex(y * rCtx.mnNumberOfContributions);
+
+        for(long x(0); x < rCtx.mnDestWidth; x++)
+        {
+            double aSum(0.0);
+            double aValueRed(0.0);
+            double aValueGreen(0.0);
+            double aValueBlue(0.0);
+
+            for(long j(0); j < rCtx.mpCount[y]; j++)
+            {
+                const long aIndex(aBaseIndex + j);
+                const double aWeight(rCtx.mpWeights[aIndex]);
+                const BitmapColor aColor(ImplGetSourceColor(*rCtx.mpSrc, bPalette, rCtx.mpPixels[aIndex], x));
+
+                aSum += aWeight;
+                aValueRed += aWeight * aColor.GetRed();
+                aValueGreen += aWeight * aColor.GetGreen();
+                aValueBlue += aWeight * aColor.GetBlue();
+            }
+
+            ImplSetResultColor(*rCtx.mpDest, y, x, aSum, aValueRed, aValueGreen, aValueBlue);
+        }
+    }
+}
+
+struct ConvolutionDone
+{
+    oslInterlockedCount mnPending;
+    osl::Condition      maDone;
+
+    explicit ConvolutionDone(oslInterlockedCount nPending)
+        : mnPending(nPending)
+    {
+    }
+};
+
+class ConvolutionTask : public comphelper::ThreadTask
+{
+    ConvolutionRangeFn          mpFn;
+    const ConvolutionContext&   mrCtx;
+    long                        mnStartY;
+    long                        mnEndY;
+    ConvolutionDone&            mrDone;
+public:
+    ConvolutionTask(ConvolutionRangeFn pFn, const ConvolutionContext& rCtx, long nStartY, long nEndY, ConvolutionDone& rDone)
+        : mpFn(pFn)
+        , mrCtx(rCtx)
+        , mnStartY(nStartY)
+        , mnEndY(nEndY)
+        , mrDone(rDone)
+    {
+    }
+    virtual void doWork() override
+    {
+        mpFn(mrCtx, mnStartY, mnEndY);
+        if(osl_atomic_decrement(&mrDone.mnPending) == 0)
+            mrDone.maDone.set();
+    }
+};
+
+// Each destination row only depends on the source, so split the rows into
+// strips and filter them on the shared thread pool when there is enough work
+void ImplConvolveRows(ConvolutionRangeFn pFn, const ConvolutionContext& rCtx, long nHeight, long nWork)
+{
+    static bool bDisableThreadedScaling = getenv("VCL_NO_THREAD_SCALE");
+    const long nEndY(nHeight - 1);
+
+    comphelper::ThreadPool& rShared = comphelper::ThreadPool::getSharedOptimalPool();
+    const long nThreads(rShared.getWorkerCount());
+
+    if(bDisableThreadedScaling || nThreads < 2 || nWork < 512 * 512 || nHeight < 2 * CONVOLUTION_THREAD_STRIP)
+    {
+        pFn(rCtx, 0, nEndY);
+        return;
+    }
+
+    const long nStrips((nHeight + CONVOLUTION_THREAD_STRIP - 1) / CONVOLUTION_THREAD_STRIP);
+    const long nRowsPerTask(std::max<long>(1, nStrips / nThreads) * CONVOLUTION_THREAD_STRIP);
+    const long nTasks(std::min<long>(nThreads - 1, nEndY / nRowsPerTask));
+
+    // wait only for the own strips, the pool may be busy with other work
+    ConvolutionDone aDone(nTasks);
+    for(long t(0); t < nTasks; t++)
+        rShared.pushTask(new ConvolutionTask(pFn, rCtx, t * nRowsPerTask, (t + 1) * nRowsPerTask - 1, aDone));
+
+    // finish the remaining rows here
+    pFn(rCtx, nTasks * nRowsPerTask, nEndY);
+    if(nTasks > 0)
+        aDone.maDone.wait();
+}
+
 bool ImplScaleConvolutionHor(Bitmap& rSource, Bitmap& rTarget, const double& rScaleX, const Kernel& aKernel)
 {
     // Do horizontal filtering
@@ -113,46 +301,8 @@ bool ImplScaleConvolutionHor(Bitmap& rSource, Bitmap& rTarget, const double& rSc
 
         if(bResult)
         {
-            for(long y(0); y < nHeight; y++)
-            {
-                for(long x(0); x < nNewWidth; x++)
-                {
-                    const long aBaseIndex(x * aNumberOfContributions);
-                    double aSum(0.0);
-                    double aValueRed(0.0);
-                    double aValueGreen(0.0);
-                    double aValueBlue(0.0);
-
-                    for(long j(0); j < pCount[x]; j++)
-                    {
-                        const long aIndex(aBaseIndex + j);
-                        const double aWeight(pWeights[aIndex]);
-                        BitmapColor aColor;
-
-                        aSum += aWeight;
-
-                        if(pReadAcc->HasPalette())
-                        {
-                            aColor = pReadAcc->GetPaletteColor(pReadAcc->GetPixelIndex(y, pPixels[aIndex]));
-                        }
-                        else
-                        {
-                            aColor = pReadAcc->GetPixel(y, pPixels[aIndex]);
-                        }
-
-                        aValueRed += aWeight * aColor.GetRed();
-                        aValueGreen += aWeight * aColor.GetGreen();
-                        aValueBlue += aWeight * aColor.GetBlue();
-                    }
-
-                    const BitmapColor aResultColor(
-                        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(aValueRed / aSum), 0, 255)),
-                        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(aValueGreen / aSum), 0, 255)),
-                        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(aValueBlue / aSum), 0, 255)));
-
-                    pWriteAcc->SetPixel(y, x, aResultColor);
-                }
-            }
+            const ConvolutionContext aContext(pReadAcc, pWriteAcc, pWeights, pPixels, pCount, aNumberOfContributions);
+            ImplConvolveRows(ImplConvolveRowsHor, aContext, nHeight, nNewWidth * nHeight * aNumberOfContributions);
 
             Bitmap::ReleaseAccess(pWriteAcc);
         }
@@ -200,53 +350,8 @@ bool ImplScaleConvolutionVer(Bitmap& rSource, Bitmap& rTarget, const double& rSc
 
         if(pWriteAcc)
         {
-            for(long x(0); x < nWidth; x++)
-            {
-                for(long y(0); y < nNewHeight; y++)
-                {
-                    const long aBaseIndex(y * aNumberOfContributions);
-                    double aSum(0.0);
-                    double aValueRed(0.0);
-                    double aValueGreen(0.0);
-                    double aValueBlue(0.0);
-
-                    for(long j(0); j < pCount[y]; j++)
-                    {
-                        const long aIndex(aBaseIndex + j);
-                        const double aWeight(pWeights[aIndex]);
-                        BitmapColor aColor;
-
-                        aSum += aWeight;
-
-                        if(pReadAcc->HasPalette())
-                        {
-                            aColor = pReadAcc->GetPaletteColor(pReadAcc->GetPixelIndex(pPixels[aIndex], x));
-                        }
-                        else
-                        {
-                            aColor = pReadAcc->GetPixel(pPixels[aIndex], x);
-                        }
-
-                        aValueRed += aWeight * aColor.GetRed();
-                        aValueGreen += aWeight * aColor.GetGreen();
-                        aValueBlue += aWeight * aColor.GetBlue();
-                    }
-
-                    const BitmapColor aResultColor(
-                        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(aValueRed / aSum), 0, 255)),
-                        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(aValueGreen / aSum), 0, 255)),
-                        static_cast< sal_uInt8 >(MinMax(static_cast< sal_Int32 >(aValueBlue / aSum), 0, 255)));
-
-                    if(pWriteAcc->HasPalette())
-                    {
-                        pWriteAcc->SetPixelIndex(y, x, static_cast< sal_uInt8 >(pWriteAcc->GetBestPaletteIndex(aResultColor)));
-                    }
-                    else
-                    {
-                        pWriteAcc->SetPixel(y, x, aResultColor);
-                    }
-                }
-            }
+            const ConvolutionContext aContext(pReadAcc, pWriteAcc, pWeights, pPixels, pCount, aNumberOfContributions);
+            ImplConvolveRows(ImplConvolveRowsVer, aContext, nNewHeight, nWidth * nNewHeight * aNumberOfContributions);
         }
 
         Bitmap::ReleaseAccess(pWriteAcc);
@@ -1494,7 +1494,7 @@ sal_uInt16 GraphicFilter::ImportGraphic( Graphic& rGraphic, const OUString& rPat
             if( !( nImportFlags & GraphicFilterImportFlags::DontSetLogsizeForJpeg ) )
                 nImportFlags |= GraphicFilterImportFlags::SetLogsizeForJpeg;
 
-            if( !ImportJPEG( rIStream, rGraphic, nullptr, nImportFlags ) )
+            if( !ImportJPEG( rIStream, rGraphic, nullptr, nImportFlags, &aPreviewSizeHint ) )
                 nStatus = GRFILTER_FILTERERROR;
             else
                 eLinkType = GFX_LINK_TYPE_NATIVE_JPG;
@@ -25,7 +25,8 @@
 #include <vcl/FilterConfigItem.hxx>
 #include <vcl/graphicfilter.hxx>
 
-VCL_DLLPUBLIC bool ImportJPEG( SvStream& rInputStream, Graphic& rGraphic, void* pCallerData, GraphicFilterImportFlags nImportFlags )
+VCL_DLLPUBLIC bool ImportJPEG( SvStream& rInputStream, Graphic& rGraphic, void* pCallerData, GraphicFilterImportFlags nImportFlags,
+                               const Size* pSizeHint )
 {
     ReadState   eReadState;
     bool        bReturn = true;
@@ -39,7 +40,11 @@ VCL_DLLPUBLIC bool ImportJPEG( SvStream& rInputStream, Graphic& rGraphic, void*
 
     if( nImportFlags & GraphicFilterImportFlags::ForPreview )
     {
-        pJPEGReader->SetPreviewSize( Size(128,128) );
+        // let libjpeg scale in the DCT domain down to the requested size
+        if( pSizeHint && ( pSizeHint->Width() || pSizeHint->Height() ) )
+            pJPEGReader->SetPreviewSize( *pSizeHint );
+        else
+            pJPEGReader->SetPreviewSize( Size(128,128) );
     }
     else
     {
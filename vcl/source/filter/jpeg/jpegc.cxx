@@ -133,11 +133,13 @@ void ReadJPEG( JPEGReader* pJPEGReader, void* pInputStream, long* pLines,
             }
         }
 
+        // pick the largest denominator which still gives at least the
+        // requested size, so that the caller only ever scales down
         for( cinfo.scale_denom = 1; cinfo.scale_denom < 8; cinfo.scale_denom *= 2 )
         {
-            if( cinfo.image_width < nPreviewWidth * cinfo.scale_denom )
+            if( cinfo.image_width < nPreviewWidth * cinfo.scale_denom * 2 )
                 break;
-            if( cinfo.image_height < nPreviewHeight * cinfo.scale_denom )
+            if( cinfo.image_height < nPreviewHeight * cinfo.scale_denom * 2 )
                 break;
         }
 
@@ -36,10 +36,13 @@
 #include <comphelper/processfactory.hxx>
 #include <comphelper/random.hxx>
 #include <comphelper/string.hxx>
+#include <comphelper/threadpool.hxx>
 #include <cppuhelper/implbase.hxx>
 #include <i18nlangtag/languagetag.hxx>
 #include <o3tl/numeric.hxx>
+#include <osl/conditn.hxx>
 #include <osl/file.hxx>
+#include <osl/interlck.h>
 #include <osl/thread.h>
 #include <rtl/crc.h>
 #include <rtl/digest.h>
@@ -2122,6 +2125,64 @@ bool PDFWriterImpl::compressStream( SvMemoryStream* pStream )
 #endif
 }
 
+namespace {
+
+/// lets compressStreams wait for its own tasks only, not for all of the shared pool
+struct CompressStreamsDone
+{
+    oslInterlockedCount mnPending;
+    osl::Condition      maDone;
+
+    explicit CompressStreamsDone( oslInterlockedCount nPending )
+        : mnPending( nPending )
+    {}
+};
+
+class CompressStreamTask : public comphelper::ThreadTask
+{
+    SvMemoryStream*         mpStream;
+    CompressStreamsDone&    mrDone;
+public:
+    CompressStreamTask( SvMemoryStream* pStream, CompressStreamsDone& rDone )
+        : mpStream( pStream )
+        , mrDone( rDone )
+    {}
+    virtual void doWork() override
+    {
+        PDFWriterImpl::compressStream( mpStream );
+        if( osl_atomic_decrement( &mrDone.mnPending ) == 0 )
+            mrDone.maDone.set();
+    }
+};
+
+}
+
+bool PDFWriterImpl::compressStreams( const std::vector< SvMemoryStream* >& rStreams )
+{
+#ifndef DEBUG_DISABLE_PDFCOMPRESSION
+    comphelper::ThreadPool& rPool = comphelper::ThreadPool::getSharedOptimalPool();
+    if( rStreams.size() < 2 || rPool.getWorkerCount() == 0 )
+    {
+        for( SvMemoryStream* pStream : rStreams )
+            compressStream( pStream );
+        return true;
+    }
+
+    // the streams are independent of each other and ZCodec keeps all of its
+    // state per instance, so deflating them concurrently is safe; the first
+    // one is done right here while the pool works on the others
+    CompressStreamsDone aDone( rStreams.size() - 1 );
+    for( size_t i = 1; i < rStreams.size(); ++i )
+        rPool.pushTask( new CompressStreamTask( rStreams[i], aDone ) );
+    compressStream( rStreams[0] );
+    aDone.maDone.wait();
+    return true;
+#else
+    (void)rStreams;
+    return false;
+#endif
+}
+
 void PDFWriterImpl::beginCompression()
 {
 #ifndef DEBUG_DISABLE_PDFCOMPRESSION
@@ -2320,12 +2381,21 @@ void PDFWriterImpl::endPage()
                 jpeg->m_aMask = Bitmap();
             }
         }
+        // deflate all pending transparency groups of this page in one go
+        std::vector< SvMemoryStream* > aContentStreams;
+        for( std::list<TransparencyEmit>::iterator t = m_aTransparentObjects.begin();
+             t != m_aTransparentObjects.end(); ++t )
+        {
+            if( t->m_pContentStream )
+                aContentStreams.push_back( t->m_pContentStream );
+        }
+        bool bFlateFilter = compressStreams( aContentStreams );
         for( std::list<TransparencyEmit>::iterator t = m_aTransparentObjects.begin();
              t != m_aTransparentObjects.end(); ++t )
         {
             if( t->m_pContentStream )
             {
-                writeTransparentObject( *t );
+                writeTransparentObject( *t, bFlateFilter );
                 delete t->m_pContentStream;
                 t->m_pContentStream = nullptr;
             }
@@ -2804,6 +2874,14 @@ bool PDFWriterImpl::emitTilings()
 {
     OStringBuffer aTilingObj( 1024 );
 
+    std::vector< SvMemoryStream* > aTilingStreams;
+    for( std::vector<TilingEmit>::iterator it = m_aTilings.begin(); it != m_aTilings.end(); ++it )
+    {
+        if( it->m_pTilingStream )
+            aTilingStreams.push_back( it->m_pTilingStream );
+    }
+    bool bDeflate = compressStreams( aTilingStreams );
+
     for( std::vector<TilingEmit>::iterator it = m_aTilings.begin(); it != m_aTilings.end(); ++it )
     {
         DBG_ASSERT( it->m_pTilingStream, "tiling without stream" );
@@ -2825,7 +2903,6 @@ bool PDFWriterImpl::emitTilings()
         if( it->m_aCellSize.Height() == 0 )
             it->m_aCellSize.Height() = nH;
 
-        bool bDeflate = compressStream( it->m_pTilingStream );
         it->m_pTilingStream->Seek( STREAM_SEEK_TO_END );
         sal_Size nTilingStreamSize = it->m_pTilingStream->Tell();
         it->m_pTilingStream->Seek( STREAM_SEEK_TO_BEGIN );
@@ -8332,6 +8409,9 @@ bool PDFWriterImpl::emit()
     }
 #endif
 
+    SAL_INFO( "vcl.pdfwriter", "image cache: " << m_aImageCache.m_aEntries.size() << " distinct images, "
+              << m_aImageCache.m_nHits << " reused, " << m_aImageCache.m_nBytesSaved << " encoded bytes saved" );
+
     // emit trailer
     CHECK_RETURN( emitTrailer() );
 
@@ -10713,11 +10793,10 @@ void PDFWriterImpl::drawPixel( const Point& rPoint, const Color& rColor )
     setFillColor( aOldFillColor );
 }
 
-void PDFWriterImpl::writeTransparentObject( TransparencyEmit& rObject )
+void PDFWriterImpl::writeTransparentObject( TransparencyEmit& rObject, bool bFlateFilter )
 {
     CHECK_RETURN2( updateObject( rObject.m_nObject ) );
 
-    bool bFlateFilter = compressStream( rObject.m_pContentStream );
     rObject.m_pContentStream->Seek( STREAM_SEEK_TO_END );
     sal_uLong nSize = rObject.m_pContentStream->Tell();
     rObject.m_pContentStream->Seek( STREAM_SEEK_TO_BEGIN );
@@ -11422,18 +11501,17 @@ bool PDFWriterImpl::writeBitmapObject( BitmapEmit& rObject, bool bMask )
     return true;
 }
 
-void PDFWriterImpl::drawJPGBitmap( SvStream& rDCTData, bool bIsTrueColor, const Size& rSizePixel, const Rectangle& rTargetArea, const Bitmap& rMask )
+sal_Int32 PDFWriterImpl::drawJPGBitmap( SvStream& rDCTData, bool bIsTrueColor, const Size& rSizePixel, const Rectangle& rTargetArea, const Bitmap& rMask )
 {
     MARK( "drawJPGBitmap" );
 
-    OStringBuffer aLine( 80 );
     updateGraphicsState();
 
     // #i40055# sanity check
     if( ! (rTargetArea.GetWidth() && rTargetArea.GetHeight() ) )
-        return;
+        return -1;
     if( ! (rSizePixel.Width() && rSizePixel.Height()) )
-        return;
+        return -1;
 
     rDCTData.Seek( 0 );
     if( bIsTrueColor && m_aContext.ColorMode == PDFWriter::DrawGreyscale )
@@ -11450,7 +11528,7 @@ void PDFWriterImpl::drawJPGBitmap( SvStream& rDCTData, bool bIsTrueColor, const
         }
         else
             drawBitmap( rTargetArea.TopLeft(), rTargetArea.GetSize(), aBmp );
-        return;
+        return -1;
     }
 
     SvMemoryStream* pStream = new SvMemoryStream;
@@ -11484,6 +11562,15 @@ void PDFWriterImpl::drawJPGBitmap( SvStream& rDCTData, bool bIsTrueColor, const
     else
         delete pStream;
 
+    drawJPGObject( it->m_nObject, rTargetArea );
+
+    return it->m_nObject;
+}
+
+void PDFWriterImpl::drawJPGObject( sal_Int32 nObject, const Rectangle& rTargetArea )
+{
+    OStringBuffer aLine( 80 );
+
     aLine.append( "q " );
     sal_Int32 nCheckWidth = 0;
     m_aPages.back().appendMappedLength( (sal_Int32)rTargetArea.GetWidth(), aLine, false, &nCheckWidth );
@@ -11493,23 +11580,22 @@ void PDFWriterImpl::drawJPGBitmap( SvStream& rDCTData, bool bIsTrueColor, const
     aLine.append( ' ' );
     m_aPages.back().appendPoint( rTargetArea.BottomLeft(), aLine );
     aLine.append( " cm\n/Im" );
-    aLine.append( it->m_nObject );
+    aLine.append( nObject );
     aLine.append( " Do Q\n" );
     if( nCheckWidth == 0 || nCheckHeight == 0 )
     {
         // #i97512# avoid invalid current matrix
         aLine.setLength( 0 );
         aLine.append( "\n%jpeg image /Im" );
-        aLine.append( it->m_nObject );
+        aLine.append( nObject );
         aLine.append( " scaled to zero size, omitted\n" );
     }
     writeBuffer( aLine.getStr(), aLine.getLength() );
 
     OStringBuffer aObjName( 16 );
     aObjName.append( "Im" );
-    aObjName.append( it->m_nObject );
-    pushResource( ResXObject, aObjName.makeStringAndClear(), it->m_nObject );
-
+    aObjName.append( nObject );
+    pushResource( ResXObject, aObjName.makeStringAndClear(), nObject );
 }
 
 void PDFWriterImpl::drawBitmap( const Point& rDestPoint, const Size& rDestSize, const BitmapEmit& rBitmap, const Color& rFillColor )
@@ -223,6 +223,57 @@ public:
         ~JPGEmit() { delete m_pStream; }
     };
 
+    // identifies an image drawn by implWriteBitmapEx by its content and
+    // by everything that influences how it gets encoded
+    struct ImageCacheKey
+    {
+        BitmapChecksum  m_nChecksum;
+        Size            m_aSourceSize;
+        Size            m_aTargetSize;
+        sal_Int32       m_nQuality;
+        sal_Int32       m_nLinkType;
+        bool            m_bLossless;
+
+        ImageCacheKey()
+            : m_nChecksum( 0 )
+            , m_nQuality( 0 )
+            , m_nLinkType( 0 )
+            , m_bLossless( false )
+        {
+        }
+
+        bool operator<( const ImageCacheKey& rComp ) const;
+    };
+
+    struct ImageCacheEntry
+    {
+        // the XObject holding the JPEG encoded image, or -1
+        sal_Int32   m_nJPGObject;
+        // the XObject of the downsampled bitmap, if it was not JPEG encoded, or -1
+        sal_Int32   m_nBitmapObject;
+        sal_uInt64  m_nEncodedSize;
+
+        ImageCacheEntry()
+            : m_nJPGObject( -1 )
+            , m_nBitmapObject( -1 )
+            , m_nEncodedSize( 0 )
+        {
+        }
+    };
+
+    struct ImageCache
+    {
+        std::map< ImageCacheKey, ImageCacheEntry >  m_aEntries;
+        sal_uInt32                                  m_nHits;
+        sal_uInt64                                  m_nBytesSaved;
+
+        ImageCache()
+            : m_nHits( 0 )
+            , m_nBytesSaved( 0 )
+        {
+        }
+    };
+
     struct GradientEmit
     {
         Gradient    m_aGradient;
@@ -577,6 +628,10 @@ public:
     // returns true if compression was done
     // else false
     static bool compressStream( SvMemoryStream* );
+    // compresses each of the given independent streams in place, spreading
+    // the work over the shared thread pool; returns true if compression was
+    // done else false
+    static bool compressStreams( const std::vector< SvMemoryStream* >& rStreams );
 
     static void convertLineInfoToExtLineInfo( const LineInfo& rIn, PDFWriter::ExtLineInfo& rOut );
 private:
@@ -593,6 +648,9 @@ private:
     std::list< BitmapEmit >             m_aBitmaps;
     /* contains JPG streams until written to file     */
     std::list<JPGEmit>                  m_aJPGs;
+    /* images already downsampled and encoded by implWriteBitmapEx; identical
+       images drawn again (e.g. a logo on every page) reuse the result */
+    ImageCache                          m_aImageCache;
     /*--->i56629 contains all named destinations ever set during the PDF creation,
        destination id is always the destination's position in this vector
      */
@@ -807,7 +865,7 @@ i12626
     void updateGraphicsState(Mode mode = DEFAULT);
 
     /* writes a transparency group object */
-    void writeTransparentObject( TransparencyEmit& rObject );
+    void writeTransparentObject( TransparencyEmit& rObject, bool bFlateFilter );
 
     /* writes an XObject of type image, may create
        a second for the mask
@@ -1180,7 +1238,10 @@ public:
 
     void drawBitmap( const Point& rDestPoint, const Size& rDestSize, const Bitmap& rBitmap );
     void drawBitmap( const Point& rDestPoint, const Size& rDestSize, const BitmapEx& rBitmap );
-    void drawJPGBitmap( SvStream& rDCTData, bool bIsTrueColor, const Size& rSizePixel, const Rectangle& rTargetArea, const Bitmap& rMask );
+    /* returns the XObject the JPEG is emitted as, or -1 if it was drawn otherwise */
+    sal_Int32 drawJPGBitmap( SvStream& rDCTData, bool bIsTrueColor, const Size& rSizePixel, const Rectangle& rTargetArea, const Bitmap& rMask );
+    /* places an already created JPEG XObject into rTargetArea */
+    void drawJPGObject( sal_Int32 nObject, const Rectangle& rTargetArea );
 
     void drawGradient( const Rectangle& rRect, const Gradient& rGradient );
     void drawHatch( const tools::PolyPolygon& rPolyPoly, const Hatch& rHatch );
@@ -104,6 +104,8 @@ void PDFWriterImpl::implWriteBitmapEx( const Point& i_rPoint, const Size& i_rSiz
             bIsPng = (eType == GFX_LINK_TYPE_NATIVE_PNG);
         }
 
+        // the pixel size the image will be written with
+        Size aTargetSizePixel( aBitmapEx.GetSizePixel() );
         if( i_rContext.m_nMaxImageResolution > 50 )
         {
             // do downsampling if necessary
@@ -135,18 +137,63 @@ void PDFWriterImpl::implWriteBitmapEx( const Point& i_rPoint, const Size& i_rSiz
                     aNewBmpSize.Height() = FRound( fMaxPixelX / fBmpWH);
                 }
 
-                if( aNewBmpSize.Width() && aNewBmpSize.Height() )
-                {
-                    // #i121233# Use best quality for PDF exports
-                    aBitmapEx.Scale( aNewBmpSize, BmpScaleFlag::BestQuality );
-                }
-                else
+                aTargetSizePixel = aNewBmpSize;
+            }
+        }
+
+        ImageCacheKey aKey;
+        aKey.m_nChecksum    = aBitmapEx.GetChecksum();
+        aKey.m_aSourceSize  = aBitmapEx.GetSizePixel();
+        aKey.m_aTargetSize  = aTargetSizePixel;
+        aKey.m_nQuality     = i_rContext.m_nJPEGQuality;
+        aKey.m_nLinkType    = bIsJpeg ? GFX_LINK_TYPE_NATIVE_JPG : ( bIsPng ? GFX_LINK_TYPE_NATIVE_PNG : GFX_LINK_TYPE_NONE );
+        aKey.m_bLossless    = i_rContext.m_bOnlyLosslessCompression;
+
+        std::map< ImageCacheKey, ImageCacheEntry >::const_iterator aCached = m_aImageCache.m_aEntries.find( aKey );
+        if( aCached != m_aImageCache.m_aEntries.end() )
+        {
+            // the same image was drawn before with the same parameters:
+            // reuse its XObject instead of scaling and encoding it again
+            const ImageCacheEntry& rEntry = aCached->second;
+            ++m_aImageCache.m_nHits;
+            if( rEntry.m_nJPGObject != -1 )
+            {
+                m_aImageCache.m_nBytesSaved += rEntry.m_nEncodedSize;
+                updateGraphicsState();
+                drawJPGObject( rEntry.m_nJPGObject, Rectangle( aPoint, aSize ) );
+            }
+            else if( rEntry.m_nBitmapObject != -1 )
+            {
+                for( std::list< BitmapEmit >::const_iterator it = m_aBitmaps.begin(); it != m_aBitmaps.end(); ++it )
                 {
-                    aBitmapEx.SetEmpty();
+                    if( it->m_nObject == rEntry.m_nBitmapObject )
+                    {
+                        OStringBuffer aObjName( 16 );
+                        aObjName.append( "Im" );
+                        aObjName.append( it->m_nObject );
+                        pushResource( ResXObject, aObjName.makeStringAndClear(), it->m_nObject );
+                        drawBitmap( aPoint, aSize, *it, Color( COL_TRANSPARENT ) );
+                        break;
+                    }
                 }
             }
+            return;
         }
 
+        if( aTargetSizePixel != aBitmapEx.GetSizePixel() )
+        {
+            if( aTargetSizePixel.Width() && aTargetSizePixel.Height() )
+            {
+                // #i121233# Use best quality for PDF exports
+                aBitmapEx.Scale( aTargetSizePixel, BmpScaleFlag::BestQuality );
+            }
+            else
+            {
+                aBitmapEx.SetEmpty();
+            }
+        }
+
+        ImageCacheEntry aEntry;
         const Size aSizePixel( aBitmapEx.GetSizePixel() );
         if ( aSizePixel.Width() && aSizePixel.Height() )
         {
@@ -243,15 +290,46 @@ void PDFWriterImpl::implWriteBitmapEx( const Point& i_rPoint, const Size& i_rSiz
                 }
             }
             if ( bUseJPGCompression )
-                m_rOuterFace.DrawJPGBitmap( aStrm, bTrueColorJPG, aSizePixel, Rectangle( aPoint, aSize ), aMask );
-            else if ( aBitmapEx.IsTransparent() )
-                m_rOuterFace.DrawBitmapEx( aPoint, aSize, aBitmapEx );
+            {
+                aEntry.m_nEncodedSize = aStrm.Tell();
+                aEntry.m_nJPGObject = drawJPGBitmap( aStrm, bTrueColorJPG, aSizePixel, Rectangle( aPoint, aSize ), aMask );
+                // the JPEG was not emitted as is, so there is nothing to reuse
+                if( aEntry.m_nJPGObject == -1 )
+                    return;
+            }
             else
-                m_rOuterFace.DrawBitmap( aPoint, aSize, aBitmapEx.GetBitmap() );
+            {
+                // only the XObject is remembered, the bitmap itself stays
+                // with its BitmapEmit until that is written
+                const BitmapEmit& rEmit = createBitmapEmit(
+                    aBitmapEx.IsTransparent() ? aBitmapEx : BitmapEx( aBitmapEx.GetBitmap() ) );
+                drawBitmap( aPoint, aSize, rEmit, Color( COL_TRANSPARENT ) );
+                aEntry.m_nBitmapObject = rEmit.m_nObject;
+            }
         }
+        m_aImageCache.m_aEntries[ aKey ] = aEntry;
     }
 }
 
+bool PDFWriterImpl::ImageCacheKey::operator<( const ImageCacheKey& rComp ) const
+{
+    if( m_nChecksum != rComp.m_nChecksum )
+        return m_nChecksum < rComp.m_nChecksum;
+    if( m_aSourceSize.Width() != rComp.m_aSourceSize.Width() )
+        return m_aSourceSize.Width() < rComp.m_aSourceSize.Width();
+    if( m_aSourceSize.Height() != rComp.m_aSourceSize.Height() )
+        return m_aSourceSize.Height() < rComp.m_aSourceSize.Height();
+    if( m_aTargetSize.Width() != rComp.m_aTargetSize.Width() )
+        return m_aTargetSize.Width() < rComp.m_aTargetSize.Width();
+    if( m_aTargetSize.Height() != rComp.m_aTargetSize.Height() )
+        return m_aTargetSize.Height() < rComp.m_aTargetSize.Height();
+    if( m_nQuality != rComp.m_nQuality )
+        return m_nQuality < rComp.m_nQuality;
+    if( m_nLinkType != rComp.m_nLinkType )
+        return m_nLinkType < rComp.m_nLinkType;
+    return m_bLossless < rComp.m_bLossless;
+}
+
 void PDFWriterImpl::playMetafile( const GDIMetaFile& i_rMtf, vcl::PDFExtOutDevData* i_pOutDevData, const vcl::PDFWriter::PlayMetafileContext& i_rContext, VirtualDevice* pDummyVDev )
 {
     bool bAssertionFired( false );
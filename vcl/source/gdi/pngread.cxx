@@ -1305,6 +1305,20 @@ void PNGReaderImpl::ImplDrawScanline( sal_uInt32 nXStart, sal_uInt32 nXAdd )
                             int nLineBytes = maOrigSize.Width();
                             mpAcc->CopyScanline( nY, pTmp, BMP_FORMAT_8BIT_PAL, nLineBytes );
                         }
+                        else if( nXAdd == 1 && nXStart == 0 )  // pick every nth sample for the preview
+                        {
+                            if( !mpScanline )
+                            {
+#if OSL_DEBUG_LEVEL > 0
+                                mnAllocSizeScanline = maOrigSize.Width() * 3;
+#endif
+                                mpScanline = new sal_uInt8[maOrigSize.Width() * 3];
+                            }
+                            const long nStep( 1 << mnPreviewShift );
+                            for ( long nX = 0; nX < maTargetSize.Width(); nX++, pTmp += nStep )
+                                mpScanline[ nX ] = *pTmp;
+                            mpAcc->CopyScanline( nY, mpScanline, BMP_FORMAT_8BIT_PAL, maTargetSize.Width() );
+                        }
                         else
                         {
                             for ( long nX = nXStart; nX < maOrigSize.Width(); nX += nXAdd )
@@ -1336,9 +1350,10 @@ void PNGReaderImpl::ImplDrawScanline( sal_uInt32 nXStart, sal_uInt32 nXAdd )
             if ( mnPngDepth == 8 )  // maybe the source has 16 bit per sample
             {
                 // BMP_FORMAT_32BIT_TC_RGBA
-                // only use DirectScanline when we have no preview shifting stuff and accesses to content and alpha
+                // only use DirectScanline when we are not interlaced and have accesses to content and alpha;
+                // in preview mode only every (1 << mnPreviewShift)th source pixel is picked up
                 const bool bDoDirectScanline(
-                    bCkeckDirectScanline && !nXStart && 1 == nXAdd && !mnPreviewShift && mpMaskAcc);
+                    bCkeckDirectScanline && !nXStart && 1 == nXAdd && mpMaskAcc);
                 const bool bCustomColorTable(mpColorTable != mpDefaultColorTable);
 
                 if(bDoDirectScanline)
@@ -1371,8 +1386,9 @@ void PNGReaderImpl::ImplDrawScanline( sal_uInt32 nXStart, sal_uInt32 nXAdd )
 #endif
                     sal_uInt8* pScanline(mpScanline);
                     sal_uInt8* pScanlineAlpha(mpScanlineAlpha);
+                    const long nStep(4 << mnPreviewShift);
 
-                    for (long nX(0); nX < maOrigSize.Width(); nX++, pTmp += 4)
+                    for (long nX(0); nX < maTargetSize.Width(); nX++, pTmp += nStep)
                     {
                         // prepare content line as BGR by reordering when copying
                         // do not forget to invert alpha (source is alpha, target is opacity)
@@ -1394,8 +1410,8 @@ void PNGReaderImpl::ImplDrawScanline( sal_uInt32 nXStart, sal_uInt32 nXAdd )
 
                     // copy scanlines directly to bitmaps for content and alpha; use the formats which
                     // are able to copy directly to BitmapBuffer
-                    mpAcc->CopyScanline(nY, mpScanline, BMP_FORMAT_24BIT_TC_BGR, maOrigSize.Width() * 3);
-                    mpMaskAcc->CopyScanline(nY, mpScanlineAlpha, BMP_FORMAT_8BIT_PAL, maOrigSize.Width());
+                    mpAcc->CopyScanline(nY, mpScanline, BMP_FORMAT_24BIT_TC_BGR, maTargetSize.Width() * 3);
+                    mpMaskAcc->CopyScanline(nY, mpScanlineAlpha, BMP_FORMAT_8BIT_PAL, maTargetSize.Width());
                 }
                 else
                 {
@@ -1483,9 +1499,10 @@ void PNGReaderImpl::ImplDrawScanline( sal_uInt32 nXStart, sal_uInt32 nXAdd )
         else  // has RGB but neither alpha nor transparency
         {
             // BMP_FORMAT_24BIT_TC_RGB
-            // only use DirectScanline when we have no preview shifting stuff and access to content
+            // only use DirectScanline when we are not interlaced; in preview mode
+            // only every (1 << mnPreviewShift)th source pixel is picked up
             const bool bDoDirectScanline(
-                bCkeckDirectScanline && !nXStart && 1 == nXAdd && !mnPreviewShift);
+                bCkeckDirectScanline && !nXStart && 1 == nXAdd);
             const bool bCustomColorTable(mpColorTable != mpDefaultColorTable);
 
             if(bDoDirectScanline && !mpScanline)
@@ -1506,8 +1523,9 @@ void PNGReaderImpl::ImplDrawScanline( sal_uInt32 nXStart, sal_uInt32 nXAdd )
                     OSL_ENSURE(mnAllocSizeScanline >= maOrigSize.Width() * 3, "Allocated Scanline too small (!)");
 #endif
                     sal_uInt8* pScanline(mpScanline);
+                    const long nStep(3 << mnPreviewShift);
 
-                    for (long nX(0); nX < maOrigSize.Width(); nX++, pTmp += 3)
+                    for (long nX(0); nX < maTargetSize.Width(); nX++, pTmp += nStep)
                     {
                         // prepare content line as BGR by reordering when copying
                         if(bCustomColorTable)
@@ -1526,7 +1544,7 @@ void PNGReaderImpl::ImplDrawScanline( sal_uInt32 nXStart, sal_uInt32 nXAdd )
 
                     // copy scanline directly to bitmap for content; use the format which is able to
                     // copy directly to BitmapBuffer
-                    mpAcc->CopyScanline(nY, mpScanline, BMP_FORMAT_24BIT_TC_BGR, maOrigSize.Width() * 3);
+                    mpAcc->CopyScanline(nY, mpScanline, BMP_FORMAT_24BIT_TC_BGR, maTargetSize.Width() * 3);
                 }
                 else
                 {